@@ -12,6 +12,22 @@
 // includes the official library
 #include <Gamebuino-Meta.h>
 
+// -------------------------------------------------------------------------
+// Options
+// -------------------------------------------------------------------------
+// The console behaves like the original game by default: the game scene is
+// rendered on every frame, and the display always stays on. The following
+// options, which save power, must be uncommented to be enabled.
+// -------------------------------------------------------------------------
+
+// the game logic keeps its pace even if a frame overruns,
+// and the game scene is only rendered when it changes
+// #define DECOUPLED_RENDERING
+
+// the display is switched off after this delay of demonstration
+// without anyone pressing a button (in seconds)
+// #define IDLE_TIMEOUT (5 * 60)
+
 // -------------------------------------------------------------------------
 // Initialization
 // -------------------------------------------------------------------------
@@ -29,6 +45,19 @@ void setup() {
     gb.setFrameRate(Game::FrameRate);
     // initializes the game engine
     game.setup();
+    // the random sequence differs at each start: the time elapsed since
+    // power-up is mixed with the noise of a floating analog input
+    game.setSeed(micros() ^ analogRead(0));
+    // the rendering may be decoupled from the game logic (but not on the
+    // host, where the logic must not depend on the wall clock: its runner
+    // only decouples the rendering on demand)
+#if defined(DECOUPLED_RENDERING) && !defined(GAMEBUINO_HOST)
+    game.decouple(Game::FrameRate);
+#endif
+    // and the display may be switched off when nobody plays
+#ifdef IDLE_TIMEOUT
+    game.setIdleTimeout(IDLE_TIMEOUT);
+#endif
 }
 
 // -------------------------------------------------------------------------
@@ -37,8 +66,9 @@ void setup() {
 
 void loop() {
     // makes sure that the Gamebuino Meta runs at a constant framerate
-    // (as long as the CPU load is not exceeded)
-    gb.waitForUpdate();
+    // (as long as the CPU load is not exceeded), while letting the CPU
+    // sleep until the next frame when there is nothing else to do
+    while (!gb.update()) game.idle();
     // delegates the control loop to the game engine
     game.loop();
 }
\ No newline at end of file
@@ -0,0 +1,225 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                        Host Stand-in for the META API
+// -------------------------------------------------------------------------
+
+// loads the header file of the stand-in
+#include "Gamebuino-Meta.h"
+
+#include <chrono>
+#include <random>
+#include <stdio.h>
+
+// the console itself (one per thread)
+thread_local Gamebuino gb;
+thread_local SPIClass SPI;
+
+// -------------------------------------------------------------------------
+// Arduino core
+// -------------------------------------------------------------------------
+
+static thread_local std::minstd_rand generator;
+
+long random(long max) {
+    return max > 0 ? generator() % max : 0;
+}
+
+long random(long min, long max) {
+    return min < max ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) {
+    generator.seed(seed);
+}
+
+static const std::chrono::steady_clock::time_point startup = std::chrono::steady_clock::now();
+
+uint32_t micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startup).count();
+}
+
+uint32_t millis() {
+    return micros() / 1000;
+}
+
+// -------------------------------------------------------------------------
+// Display device
+// -------------------------------------------------------------------------
+
+namespace Gamebuino_Meta {
+
+    void wait_for_transfers_done() {
+        gb.tft.waitForTransfer();
+    }
+
+    bool is_transfer_done() {
+        return gb.tft.transferDone();
+    }
+
+    Display_ST7735::Display_ST7735() :
+        x0(0), y0(0), x1(Width - 1), y1(Height - 1), cx(0), cy(0),
+        sentPixels(0), transfers(0),
+        cpuScale(1), busyUntil(0), transferTime(0), stallTime(0) {
+        memset(pixels, 0, sizeof(pixels));
+    }
+
+    uint64_t Display_ST7735::now() const {
+        uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startup).count();
+        return elapsed * cpuScale + stallTime;
+    }
+
+    bool Display_ST7735::transferDone() const {
+        return now() >= busyUntil;
+    }
+
+    // the host does not actually wait: the time the CPU would have
+    // spent waiting is simply added to the modeled time
+    void Display_ST7735::waitForTransfer() {
+        uint64_t time = now();
+        if (time < busyUntil) stallTime += busyUntil - time;
+    }
+
+    // the data that will be sent next will be written in this window
+    void Display_ST7735::setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+        this->x0 = cx = x0 < Width  ? x0 : Width  - 1;
+        this->y0 = cy = y0 < Height ? y0 : Height - 1;
+        this->x1 = x1 < Width  ? x1 : Width  - 1;
+        this->y1 = y1 < Height ? y1 : Height - 1;
+    }
+
+    // pixels are written one after the other inside the window,
+    // wrapping at its right border, just like the real controller does
+    void Display_ST7735::sendBuffer(uint16_t * buffer, uint16_t n) {
+        for (uint16_t i = 0; i < n; i++) {
+            pixels[cx + cy * Width] = buffer[i];
+            if (cx++ == x1) {
+                cx = x0;
+                cy = cy == y1 ? y0 : cy + 1;
+            }
+        }
+        sentPixels += n;
+        transfers++;
+        // the bus is busy for 16 clock cycles per pixel, starting
+        // as soon as the previous transfer has been completed
+        if (SPI.clock) {
+            uint64_t time     = now();
+            uint64_t duration = 16000000000ull * n / SPI.clock;
+            busyUntil     = (time > busyUntil ? time : busyUntil) + duration;
+            transferTime += duration;
+        }
+    }
+
+    uint16_t Display_ST7735::getPixel(uint8_t x, uint8_t y) const {
+        uint16_t c = pixels[x + y * Width];
+        return (c << 8) | (c >> 8);
+    }
+
+    bool Display_ST7735::writePPM(const char * path) const {
+        FILE * file = fopen(path, "wb");
+        if (file == NULL) return false;
+        fprintf(file, "P6\n%d %d\n255\n", Width, Height);
+        for (uint8_t y = 0; y < Height; y++) {
+            for (uint8_t x = 0; x < Width; x++) {
+                uint16_t c = getPixel(x, y);
+                uint8_t  rgb[3] = {
+                    (uint8_t)(((c >> 11) & 0x1f) * 255 / 0x1f),
+                    (uint8_t)(((c >>  5) & 0x3f) * 255 / 0x3f),
+                    (uint8_t)(( c        & 0x1f) * 255 / 0x1f)
+                };
+                fwrite(rgb, 1, 3, file);
+            }
+        }
+        return fclose(file) == 0;
+    }
+
+    uint32_t Display_ST7735::checksum() const {
+        uint32_t hash = 2166136261u;
+        for (uint16_t i = 0; i < Width * Height; i++) {
+            hash = (hash ^ (pixels[i] & 0xff)) * 16777619u;
+            hash = (hash ^ (pixels[i] >> 8))   * 16777619u;
+        }
+        return hash;
+    }
+
+// -------------------------------------------------------------------------
+// Buttons
+// -------------------------------------------------------------------------
+
+    bool Buttons::pressed(Button button) const {
+        uint8_t mask = 1 << (uint8_t)button;
+        return (state & mask) && !(previous & mask);
+    }
+
+    bool Buttons::released(Button button) const {
+        uint8_t mask = 1 << (uint8_t)button;
+        return !(state & mask) && (previous & mask);
+    }
+
+    bool Buttons::held(Button button) const {
+        return state & (1 << (uint8_t)button);
+    }
+
+// -------------------------------------------------------------------------
+// Saves
+// -------------------------------------------------------------------------
+
+    Save::Save() {
+        memset(blocks, 0, sizeof(blocks));
+    }
+
+    int32_t Save::get(uint16_t i) {
+        return i < Blocks ? blocks[i] : 0;
+    }
+
+    bool Save::set(uint16_t i, int32_t value) {
+        if (i >= Blocks) return false;
+        blocks[i] = value;
+        return true;
+    }
+
+};
+
+// -------------------------------------------------------------------------
+// Console
+// -------------------------------------------------------------------------
+
+Gamebuino::Gamebuino() : frameDuration(40000), frameStart(0), cpuLoad(0), frameCount(0) {}
+
+void Gamebuino::begin() {
+    frameStart = micros();
+}
+
+void Gamebuino::setFrameRate(uint8_t fps) {
+    frameDuration = 1000000 / fps;
+}
+
+// the host does not wait for anything: frames are chained as fast as
+// possible, and the CPU load is the share of the frame duration that
+// would have been consumed on a real console running at the same speed
+bool Gamebuino::update() {
+    uint32_t now  = micros();
+    uint32_t load = 100 * (now - frameStart) / frameDuration;
+    cpuLoad       = load < 255 ? load : 255;
+    frameStart    = now;
+    buttons.update();
+    frameCount++;
+    return true;
+}
+
+void Gamebuino::waitForUpdate() {
+    while (!update());
+}
+
+uint8_t Gamebuino::getCpuLoad() {
+    return cpuLoad;
+}
+
+// there is no such thing as a memory shortage on the host
+uint16_t Gamebuino::getFreeRam() {
+    return 0;
+}
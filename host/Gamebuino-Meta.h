@@ -0,0 +1,305 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                        Host Stand-in for the META API
+// -------------------------------------------------------------------------
+// This header takes the place of the official `Gamebuino-Meta.h` when the
+// game is built on a desktop machine with CMake. It only provides the small
+// part of the API the engine actually uses, so that the sources located in
+// the `src` folder can be compiled unchanged into a Linux executable.
+//
+// Nothing is displayed on screen: the buffers sent to the display device
+// through `gb.tft` are simply copied into an in-memory 160x128 RGB565
+// surface, which can be inspected or saved as an image afterwards.
+// Sound effects are swallowed, buttons are driven by the host program and
+// the microSD saves are kept in memory.
+// -------------------------------------------------------------------------
+
+#ifndef DONKEY_KONG_JR_HOST_GAMEBUINO_META
+#define DONKEY_KONG_JR_HOST_GAMEBUINO_META
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+// allows the engine to know that it is running on the host
+#define GAMEBUINO_HOST 1
+
+// -------------------------------------------------------------------------
+// Arduino core
+// -------------------------------------------------------------------------
+
+// returns a pseudo-random number between 0 and max - 1
+long random(long max);
+// returns a pseudo-random number between min and max - 1
+long random(long min, long max);
+// initializes the pseudo-random number generator
+void randomSeed(unsigned long seed);
+
+// reads an analog input (none is wired on the host)
+inline int analogRead(uint8_t /*pin*/) { return 0; }
+
+// puts the CPU to sleep until the next interrupt (nothing to wait for here)
+inline void __WFI() {}
+
+// number of milliseconds / microseconds elapsed since the program started
+uint32_t millis();
+uint32_t micros();
+
+// minimalist version of the Arduino character string
+class String
+{
+    private:
+
+        std::string s;
+
+    public:
+
+        String(const char * s = "") : s(s) {}
+        String(int value)           : s(std::to_string(value)) {}
+        String(unsigned int value)  : s(std::to_string(value)) {}
+        String(long value)          : s(std::to_string(value)) {}
+        String(unsigned long value) : s(std::to_string(value)) {}
+
+        unsigned int length() const        { return s.length(); }
+        char charAt(unsigned int i) const  { return i < s.length() ? s[i] : 0; }
+        const char * c_str() const         { return s.c_str(); }
+};
+
+// -------------------------------------------------------------------------
+// SPI bus
+// -------------------------------------------------------------------------
+
+#define MSBFIRST  1
+#define SPI_MODE0 0x02
+
+struct SPISettings {
+    uint32_t clock;
+    uint8_t  bitOrder;
+    uint8_t  dataMode;
+
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) :
+        clock(clock),
+        bitOrder(bitOrder),
+        dataMode(dataMode)
+        {}
+};
+
+class SPIClass
+{
+    public:
+
+        uint32_t clock; // host only: clock of the current transaction (in Hz)
+
+        SPIClass() : clock(0) {}
+
+        void beginTransaction(SPISettings settings) { clock = settings.clock; }
+        void endTransaction() {}
+        uint8_t transfer(uint8_t /*data*/) { return 0; }
+};
+
+extern thread_local SPIClass SPI;
+
+// -------------------------------------------------------------------------
+// Gamebuino META
+// -------------------------------------------------------------------------
+
+enum class ColorMode : uint8_t {
+    index,
+    rgb565
+};
+
+enum class Button : uint8_t {
+    down,
+    left,
+    right,
+    up,
+    a,
+    b,
+    menu,
+    home
+};
+
+#define BUTTON_DOWN  Button::down
+#define BUTTON_LEFT  Button::left
+#define BUTTON_RIGHT Button::right
+#define BUTTON_UP    Button::up
+#define BUTTON_A     Button::a
+#define BUTTON_B     Button::b
+#define BUTTON_MENU  Button::menu
+#define BUTTON_HOME  Button::home
+
+namespace Gamebuino_Meta {
+
+    // waits until the display device has received all the data sent
+    void wait_for_transfers_done();
+    // checks whether the display device has received all the data sent
+    bool is_transfer_done();
+
+    enum class Sound_FX_Wave : uint8_t {
+        NOISE,
+        SQUARE
+    };
+
+    struct Sound_FX {
+        Sound_FX_Wave type;
+        uint8_t       continue_flag;
+        int32_t       volume_start;
+        int32_t       volume_sweep;
+        int32_t       period_sweep;
+        int32_t       period_start;
+        int32_t       length;
+    };
+
+    // stand-in for the display device
+    class Display_ST7735
+    {
+        private:
+
+            uint8_t  x0, y0, x1, y1; // current address window
+            uint8_t  cx, cy;         // current write position inside the window
+
+        public:
+
+            static constexpr uint8_t Width  = 160;
+            static constexpr uint8_t Height = 128;
+
+            // the screen surface, as the display device would have received it
+            // (the 16-bit color codes are therefore byte-swapped RGB565)
+            uint16_t pixels[Width * Height];
+
+            uint32_t sentPixels; // total number of pixels received since startup
+            uint32_t transfers;  // total number of buffers received since startup
+
+            // timing model of the transfers: the buffers are received at once,
+            // but each of them keeps the SPI bus busy for the time it would
+            // take at the clock of the transaction. the modeled time is the
+            // time elapsed on the host, stretched by `cpuScale` to match the
+            // speed of the META, plus the time spent waiting for the bus
+            uint32_t cpuScale;     // how many times the META is slower than the host
+            uint64_t busyUntil;    // modeled time at which the bus is free again (in ns)
+            uint64_t transferTime; // total time the bus has been busy (in ns)
+            uint64_t stallTime;    // total time spent waiting for the bus (in ns)
+
+            Display_ST7735();
+
+            // host only: returns the modeled time elapsed since startup (in ns)
+            uint64_t now() const;
+            // host only: checks whether the last buffer has been fully transferred
+            bool transferDone() const;
+            // host only: waits for the last buffer to be fully transferred
+            void waitForTransfer();
+
+            void setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+            void commandMode() {}
+            void dataMode() {}
+            void idleMode() {}
+            void sendBuffer(uint16_t * buffer, uint16_t n);
+
+            // host only: returns the color of a pixel as a standard RGB565 code
+            uint16_t getPixel(uint8_t x, uint8_t y) const;
+            // host only: saves the screen surface as a binary PPM image
+            bool writePPM(const char * path) const;
+            // host only: returns a FNV-1a hash of the screen surface
+            uint32_t checksum() const;
+    };
+
+    class Display
+    {
+        public:
+
+            void init(uint8_t /*width*/, uint8_t /*height*/, ColorMode /*mode*/) {}
+    };
+
+    class Buttons
+    {
+        private:
+
+            uint8_t next;     // buttons that will be held from the next frame
+            uint8_t state;    // buttons held during the current frame
+            uint8_t previous; // buttons held during the previous frame
+
+        public:
+
+            Buttons() : next(0), state(0), previous(0) {}
+
+            // host only: sets the buttons held from the next frame
+            void setState(uint8_t mask) { next = mask; }
+            // host only: returns the buttons held during the current frame
+            uint8_t getState() const { return state; }
+
+            // moves on to the next frame
+            void update() { previous = state; state = next; }
+
+            bool pressed(Button button) const;
+            bool released(Button button) const;
+            bool held(Button button) const;
+    };
+
+    class Sound
+    {
+        public:
+
+            uint32_t played; // number of sound effects requested since startup
+
+            Sound() : played(0) {}
+
+            void fx(const Sound_FX * /*fx*/) { played++; }
+    };
+
+    class Save
+    {
+        private:
+
+            static constexpr uint8_t Blocks = 64;
+
+            int32_t blocks[Blocks];
+
+        public:
+
+            Save();
+
+            int32_t get(uint16_t i);
+            bool    set(uint16_t i, int32_t value);
+    };
+
+};
+
+class Gamebuino
+{
+    private:
+
+        uint32_t frameDuration; // duration of a frame (in microseconds)
+        uint32_t frameStart;    // timecode of the beginning of the current frame
+        uint8_t  cpuLoad;       // time spent computing the previous frame (in percent)
+
+    public:
+
+        uint32_t frameCount;
+
+        Gamebuino_Meta::Display_ST7735 tft;
+        Gamebuino_Meta::Display        display;
+        Gamebuino_Meta::Buttons        buttons;
+        Gamebuino_Meta::Sound          sound;
+        Gamebuino_Meta::Save           save;
+
+        Gamebuino();
+
+        void     begin();
+        void     setFrameRate(uint8_t fps);
+        bool     update();
+        void     waitForUpdate();
+        uint8_t  getCpuLoad();
+        uint16_t getFreeRam();
+};
+
+// each thread has its own console, so that several game engines
+// can run at the same time in a single process
+extern thread_local Gamebuino gb;
+
+#endif
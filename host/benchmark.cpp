@@ -0,0 +1,216 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                          Headless Render Benchmark
+// -------------------------------------------------------------------------
+// Measures the cost of the slice compositor (`Renderer::draw` and
+// `Game::drawOnSlice`) on scripted game scenes:
+//
+//     dkjr-benchmark [--cpu-scale N] [frames]
+//
+// Each scenario renders the requested number of frames (5000 by default)
+// and reports the number of slices and pixels sent to the display, the
+// time spent per frame and per slice, and a checksum of the final image.
+// The output has one line per scenario in a fixed format, so that the
+// results of two commits can be compared with `diff`: only the timings are
+// expected to change, unless the rendered images are not the same.
+//
+// The transfers to the display device are timed by the model of the SPI
+// bus of the stand-in, which also reports, per frame, how long the bus has
+// been busy and how long the CPU has waited for it. The host is much faster
+// than the META, so its time is stretched by the `--cpu-scale` factor (50
+// by default, which roughly matches a desktop core against the 48 MHz
+// Cortex-M0+ of the META). The benchmark is built for several geometries
+// of the renderer (`dkjr-benchmark-<rows>x<buffers>`, see the `benchmarks`
+// target), in order to weigh the stalls they save against their RAM cost.
+// -------------------------------------------------------------------------
+
+// loads the game engine
+#include "../src/engine/Game.h"
+#include "../src/graphics/sprites.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+// -------------------------------------------------------------------------
+// Scripted scenes
+// -------------------------------------------------------------------------
+
+// a scene of the game where nothing happens but the background
+static void clear(Scene & scene, uint32_t frame) {
+    scene.boot    = false;
+    scene.junior  = Bottom1;
+    scene.arm     = Forbidden;
+    scene.fruit   = Forbidden;
+    scene.key     = Forbidden;
+    scene.cage    = 0x0f;
+    scene.smile   = false;
+    scene.info    = InfoGameA;
+    scene.miss    = 0;
+    scene.birds   = 0;
+    scene.crocs   = 0;
+    scene.counter = frame % 10000;
+}
+
+// rotates the positions of a group of enemies (one bit per position)
+static uint16_t rotate(uint16_t positions, uint8_t size, uint32_t frame) {
+    uint8_t  shift = frame % size;
+    uint16_t mask  = (1 << size) - 1;
+    return ((positions << shift) | (positions >> (size - shift))) & mask;
+}
+
+// 7 snapjaws and 4 birds move on every frame while Junior walks around
+static void fullBoard(Scene & scene, uint32_t frame) {
+    clear(scene, frame);
+    scene.junior = Bottom1 + (frame >> 2) % 6;
+    scene.fruit  = (frame >> 3) % 3;
+    scene.key    = (frame >> 2) % 4;
+    scene.miss   = (frame >> 6) % 4;
+    scene.crocs  = rotate(0x1555, Creature::CrocsSize, frame);
+    scene.birds  = rotate(0x55, Creature::BirdsSize, frame);
+}
+
+// Junior falls from the vines and misses his grab
+static void falling(Scene & scene, uint32_t frame) {
+    clear(scene, frame);
+    scene.junior = (frame >> 2) % 2 ? Fall2 : Fall1;
+    scene.key    = (frame >> 2) % 4;
+    scene.miss   = 1 + (frame >> 5) % 3;
+    scene.crocs  = rotate(0x0011, Creature::CrocsSize, frame >> 1);
+    scene.birds  = rotate(0x03, Creature::BirdsSize, frame >> 1);
+}
+
+// Junior unlocks the cage, whose unlocked parts are blinking
+static void unlocking(Scene & scene, uint32_t frame) {
+    uint8_t unlocked = (frame / Game::FrameRate) % 5;
+    bool    blink    = frame % Game::FrameRate < Game::FrameRate >> 1;
+    clear(scene, frame);
+    scene.junior = (frame >> 3) % 2 ? Unlock : GrabKey;
+    scene.arm    = (frame >> 2) % 2 ? ArmDown : ArmUp;
+    scene.smile  = unlocked == 4 && blink;
+    scene.cage   = 0;
+    for (uint8_t i = 0; i < 4 && unlocked != 4; i++) {
+        if (i >= unlocked || blink) scene.cage |= 1 << i;
+    }
+}
+
+// -------------------------------------------------------------------------
+// Measurement
+// -------------------------------------------------------------------------
+
+typedef void (*Script)(Scene & scene, uint32_t frame);
+
+struct Result {
+    uint32_t slices;
+    uint32_t pixels;
+    uint64_t ns;
+    uint64_t busy;  // modeled time of the transfers (in ns)
+    uint64_t stall; // modeled time spent waiting for the transfers (in ns)
+};
+
+// renders a scene and accumulates the measurements
+static void render(Game & game, const Scene & scene, Result & result) {
+    uint32_t transfers = gb.tft.transfers;
+    uint32_t pixels    = gb.tft.sentPixels;
+    uint64_t busy      = gb.tft.transferTime;
+    uint64_t stall     = gb.tft.stallTime;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    game.drawScene(scene);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    result.slices += gb.tft.transfers - transfers;
+    result.pixels += gb.tft.sentPixels - pixels;
+    result.ns     += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    result.busy   += gb.tft.transferTime - busy;
+    result.stall  += gb.tft.stallTime - stall;
+}
+
+static void report(const char * name, uint32_t frames, const Result & result) {
+    printf("%-10s %8u %8u %10u %10u %10u %10u %10u   %08x\n",
+        name,
+        frames,
+        result.slices,
+        result.pixels,
+        (unsigned)(result.ns / frames),
+        (unsigned)(result.slices ? result.ns / result.slices : 0),
+        (unsigned)(result.busy / frames / 1000),
+        (unsigned)(result.stall / frames / 1000),
+        gb.tft.checksum()
+    );
+}
+
+// renders a scripted scenario on a fresh game engine
+static void run(const char * name, Script script, uint32_t frames) {
+    Game   game;
+    Scene  scene;
+    Result result = {0, 0, 0, 0, 0};
+
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        script(scene, frame);
+        render(game, scene, result);
+    }
+
+    report(name, frames, result);
+}
+
+// renders the scenes of the demonstration phase, as they are produced
+// by a game engine running on its own, on a second game engine (the first
+// one only advances its logic, so that it does not draw anything itself)
+static void runDemo(uint32_t frames) {
+    Game   demo;
+    Game   game;
+    Scene  scene;
+    Result result = {0, 0, 0, 0, 0};
+
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        demo.step(1);
+        demo.captureScene(scene);
+        render(game, scene, result);
+    }
+
+    report("demo", frames, result);
+}
+
+int main(int argc, char * argv[]) {
+    uint32_t frames   = 5000;
+    uint32_t cpuScale = 50;
+    int      i;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--cpu-scale") && i + 1 < argc) {
+            cpuScale = strtoul(argv[++i], NULL, 10);
+        } else {
+            break;
+        }
+    }
+    if (i < argc) frames = strtoul(argv[i++], NULL, 10);
+
+    if (frames == 0 || cpuScale == 0 || i < argc) {
+        fprintf(stderr, "usage: %s [--cpu-scale N] [frames]\n", argv[0]);
+        return 1;
+    }
+
+    gb.begin();
+    gb.setFrameRate(Game::FrameRate);
+    gb.tft.cpuScale = cpuScale;
+
+    printf("renderer: %u rows x %u buffers, %u bytes\n",
+        Renderer::SliceHeight,
+        Renderer::Buffers,
+        (unsigned)sizeof(Renderer)
+    );
+    printf("%-10s %8s %8s %10s %10s %10s %10s %10s   %s\n", "scenario", "frames", "slices", "pixels", "ns/frame", "ns/slice", "us busy/f", "us stall/f", "checksum");
+
+    runDemo(frames);
+    run("fullboard", fullBoard, frames);
+    run("falling",   falling,   frames);
+    run("unlocking", unlocking, frames);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                            Rendering Consistency
+// -------------------------------------------------------------------------
+// Checks that the partial redraws of the renderer leave the boot screen
+// alone: its images must not depend on the counter, which is hidden there
+// but still changes when MENU flips through its pages.
+//
+//     dkjr-check
+//
+// The check reports the first frame that differs and fails, so that it can
+// be run by `ctest` along with the build.
+// -------------------------------------------------------------------------
+
+// loads the game engine
+#include "../src/engine/Game.h"
+#include "../src/graphics/sprites.h"
+
+#include <stdio.h>
+
+// renders the boot screen on a fresh game engine, while the counter stays
+// put or changes on every frame (as when MENU flips through its pages),
+// and records the checksum of each image
+static void boot(bool counting, uint32_t * checksums) {
+    Game  game;
+    Scene scene;
+
+    for (uint8_t frame = 0; frame < Game::FrameRate; frame++) {
+        scene.boot    = true;
+        scene.junior  = Bottom1;
+        scene.arm     = Forbidden;
+        scene.fruit   = Forbidden;
+        scene.key     = Forbidden;
+        scene.cage    = 0x0f;
+        scene.smile   = false;
+        scene.info    = Forbidden;
+        scene.miss    = 0;
+        scene.birds   = 0;
+        scene.crocs   = 0;
+        scene.counter = counting ? 1000 + 37 * frame : 0;
+        game.drawScene(scene);
+        checksums[frame] = gb.tft.checksum();
+    }
+}
+
+int main() {
+    uint32_t expected[Game::FrameRate];
+    uint32_t actual[Game::FrameRate];
+
+    gb.begin();
+    gb.setFrameRate(Game::FrameRate);
+
+    boot(false, expected);
+    boot(true,  actual);
+
+    for (uint8_t frame = 0; frame < Game::FrameRate; frame++) {
+        if (actual[frame] != expected[frame]) {
+            fprintf(stderr, "boot frame %u is altered by the counter\n", frame);
+            return 1;
+        }
+    }
+
+    printf("boot screen: %u frames unchanged by the counter\n", Game::FrameRate);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                             Headless Host Runner
+// -------------------------------------------------------------------------
+// Runs the sketch exactly as the META would, but without any display:
+//
+//     dkjr [options] [frames] [screenshot.ppm | -] [profile.csv]
+//
+// The game runs for the requested number of frames (1000 by default), after
+// which the last rendered image can be saved in the PPM format.
+//
+// The frame times measured by the profiler can also be dumped in the CSV
+// format: one line per phase each time a window of statistics is completed.
+//
+// Options:
+//
+//     --seed N       seeds the random generator of the game engine
+//                    (0 by default, instead of the seed drawn at boot)
+//     --monkey N     presses random buttons, drawn from the seed N
+//     --record FILE  records the session in a replay file
+//     --replay FILE  replays a recorded session
+//     --skip N       simulates N frames as fast as possible before the run
+//                    (nothing is rendered, and the buttons are not pressed)
+//     --render N     renders the game scene at most N times per second
+//                    (the logic then catches up with the wall clock, so
+//                    that the runs are no longer reproducible)
+//
+// The runner ends by printing a checksum of the last image, which makes it
+// easy to check that a replay reproduces the recorded session.
+// -------------------------------------------------------------------------
+
+// loads the sketch itself
+#include "../Donkey-Kong-Jr.ino"
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+// names of the phases measured by the profiler, as they appear in the CSV file
+static const char * phaseNames[Profiler::Phases] = {
+    "creature",
+    "fruit",
+    "compose",
+    "stall",
+    "sound",
+    "sleep"
+};
+
+// writes the statistics of the last completed window
+static void writeProfile(FILE * file, Profiler * profiler) {
+    for (uint8_t i = 0; i < Profiler::Phases; i++) {
+        Phase phase = (Phase)i;
+        fprintf(file, "%u,%s,%u,%u,%u\n", profiler->getWindows(), phaseNames[i], profiler->getMin(phase), profiler->getAvg(phase), profiler->getMax(phase));
+    }
+}
+
+// -------------------------------------------------------------------------
+// Replay files
+// -------------------------------------------------------------------------
+// A replay file starts with the `DKJR` signature, followed by the seed, the
+// start frame, the number of frames and the number of bytes of the
+// recording (32-bit little-endian integers), and then the recorded bytes.
+// -------------------------------------------------------------------------
+
+static constexpr uint32_t ReplayCapacity = 1 << 20;
+
+static void writeNumber(FILE * file, uint32_t n) {
+    uint8_t bytes[4] = { (uint8_t)n, (uint8_t)(n >> 8), (uint8_t)(n >> 16), (uint8_t)(n >> 24) };
+    fwrite(bytes, 1, 4, file);
+}
+
+static bool readNumber(FILE * file, uint32_t & n) {
+    uint8_t bytes[4];
+    if (fread(bytes, 1, 4, file) != 4) return false;
+    n = bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+    return true;
+}
+
+static bool saveReplay(const char * path, Replay & replay) {
+    FILE * file = fopen(path, "wb");
+    if (file == NULL) return false;
+    fwrite("DKJR", 1, 4, file);
+    writeNumber(file, replay.seed);
+    writeNumber(file, replay.start);
+    writeNumber(file, replay.getFrames());
+    writeNumber(file, replay.getSize());
+    fwrite(replay.getData(), 1, replay.getSize(), file);
+    return fclose(file) == 0;
+}
+
+static bool loadReplay(const char * path, Replay & replay, uint8_t * data) {
+    FILE * file = fopen(path, "rb");
+    if (file == NULL) return false;
+    char     signature[4];
+    uint32_t frames, size;
+    bool ok = fread(signature, 1, 4, file) == 4 && memcmp(signature, "DKJR", 4) == 0
+        && readNumber(file, replay.seed)
+        && readNumber(file, replay.start)
+        && readNumber(file, frames)
+        && readNumber(file, size)
+        && size <= ReplayCapacity
+        && fread(data, 1, size, file) == size;
+    fclose(file);
+    if (ok) replay.load(size, frames);
+    return ok;
+}
+
+// -------------------------------------------------------------------------
+// Entry point
+// -------------------------------------------------------------------------
+
+int main(int argc, char * argv[]) {
+    const char * arguments[3] = { NULL, NULL, NULL };
+    const char * recordPath   = NULL;
+    const char * replayPath   = NULL;
+    uint32_t     seed         = 0;
+    uint32_t     skip         = 0;
+    uint32_t     renderRate   = 0;
+    bool         monkey       = false;
+    uint32_t     monkeySeed   = 0;
+    uint8_t      count        = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+             if (!strcmp(argv[i], "--seed")   && hasValue) seed       = strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--monkey") && hasValue) monkeySeed = strtoul(argv[++i], NULL, 10), monkey = true;
+        else if (!strcmp(argv[i], "--record") && hasValue) recordPath = argv[++i];
+        else if (!strcmp(argv[i], "--replay") && hasValue) replayPath = argv[++i];
+        else if (!strcmp(argv[i], "--skip")   && hasValue) skip       = strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--render") && hasValue) renderRate = strtoul(argv[++i], NULL, 10);
+        else if (argv[i][0] != '-' || !strcmp(argv[i], "-")) {
+            if (count < 3) arguments[count++] = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [--seed N] [--monkey N] [--record FILE] [--replay FILE] [--skip N] [--render N] [frames] [screenshot.ppm | -] [profile.csv]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    uint32_t frames = arguments[0] ? strtoul(arguments[0], NULL, 10) : 1000;
+
+    FILE * profile = NULL;
+    if (arguments[2]) {
+        profile = fopen(arguments[2], "w");
+        if (profile == NULL) {
+            fprintf(stderr, "unable to write %s\n", arguments[2]);
+            return 1;
+        }
+        fprintf(profile, "window,phase,min_us,avg_us,max_us\n");
+    }
+
+    std::vector<uint8_t> data(ReplayCapacity);
+    Replay replay(data.data(), ReplayCapacity);
+
+    setup();
+
+    // nobody is in front of the host: the display must never be switched off
+    game.setIdleTimeout(0);
+
+    if (replayPath) {
+        if (!loadReplay(replayPath, replay, data.data())) {
+            fprintf(stderr, "unable to read %s\n", replayPath);
+            return 1;
+        }
+        game.play(&replay);
+    } else {
+        // replaces the seed drawn at boot, so that the runs are reproducible
+        game.setSeed(seed);
+        if (recordPath) game.record(&replay);
+    }
+
+    if (skip) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        game.step(skip);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        printf("skipped: %u frames in %.3f s (%.0f frames/s)\n", skip, elapsed.count(), skip / elapsed.count());
+    }
+
+    if (renderRate) game.decouple(renderRate);
+
+    Profiler * profiler = game.getProfiler();
+    uint32_t   windows  = 0;
+
+    for (uint32_t i = 0; i < frames; i++) {
+        // the monkey holds a random button from time to time
+        if (monkey && !replayPath) {
+            monkeySeed = monkeySeed * 1103515245 + 12345;
+            uint32_t r = monkeySeed >> 16;
+            gb.buttons.setState(r % 3 == 0 ? 1 << ((r >> 4) % 6) : 0);
+        }
+        loop();
+        if (profile != NULL && profiler->getWindows() != windows) {
+            windows = profiler->getWindows();
+            writeProfile(profile, profiler);
+        }
+    }
+
+    if (profile != NULL) fclose(profile);
+
+    printf("frames: %u, transfers: %u, pixels: %u, checksum: %08x\n", frames, gb.tft.transfers, gb.tft.sentPixels, gb.tft.checksum());
+
+    if (recordPath) {
+        if (!saveReplay(recordPath, replay)) {
+            fprintf(stderr, "unable to write %s\n", recordPath);
+            return 1;
+        }
+        printf("replay: %u frames, %u bytes\n", replay.getFrames(), replay.getSize());
+    }
+
+    if (arguments[1] && strcmp(arguments[1], "-") != 0 && !gb.tft.writePPM(arguments[1])) {
+        fprintf(stderr, "unable to write %s\n", arguments[1]);
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,290 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                          Monte Carlo Game Simulator
+// -------------------------------------------------------------------------
+// Plays a large number of independent games, as fast as possible, to see
+// how the balancing values of the game engine (spawn odds of the enemies,
+// acceleration of the beat...) shape the games actually played:
+//
+//     dkjr-simulator [options] [games]
+//
+// Each game is played by its own game engine, seeded with its own number,
+// and the games are shared out between threads running on all the cores.
+// Nothing is rendered: the engines are only stepped frame by frame, from
+// the start of the game until its end.
+//
+// By default, the buttons are pressed at random by a player who does not
+// look at the screen. A recorded session can be given instead, whose
+// buttons are then pressed identically in all the games.
+//
+// Options:
+//
+//     --seed N       seed of the first game (the following ones are N+1, N+2...)
+//     --threads N    number of threads (all the cores by default)
+//     --game-b       plays Game B instead of Game A
+//     --replay FILE  presses the buttons of a recorded session
+//     --limit N      stops the games that last more than N frames
+//
+// The simulator reports the distribution of the scores, the survival time
+// and the causes of the failures (bird, snapjaw or fall). Since each game
+// only depends on its seed, the report does not depend on the number of
+// threads.
+// -------------------------------------------------------------------------
+
+// loads the game engine
+#include "../src/engine/Game.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// -------------------------------------------------------------------------
+// Input policies
+// -------------------------------------------------------------------------
+
+static constexpr uint32_t ReplayCapacity = 1 << 20;
+
+// the game starts a few frames after the end of the boot phase
+static constexpr uint32_t StartFrame = Game::FrameRate + 5;
+
+static uint8_t mask(Button button) {
+    return 1 << (uint8_t)button;
+}
+
+// records a session where the game is started, after which a random
+// direction or jump is pressed on one frame out of three on average
+static bool randomPolicy(Replay & replay, uint32_t seed, uint32_t frames, Button start) {
+    static const Button moves[5] = { BUTTON_LEFT, BUTTON_RIGHT, BUTTON_UP, BUTTON_DOWN, BUTTON_A };
+
+    replay.clear();
+    for (uint32_t frame = 1; frame <= frames; frame++) {
+        uint8_t buttons = 0;
+        if (frame == StartFrame) {
+            buttons = mask(start);
+        } else if (frame > StartFrame) {
+            seed = seed * 1103515245 + 12345;
+            uint32_t r = seed >> 16;
+            if (r % 3 == 0) buttons = mask(moves[(r >> 4) % 5]);
+        }
+        if (!replay.write(buttons)) return false;
+    }
+    return true;
+}
+
+// loads a session recorded by the runner (see `host/main.cpp`)
+static bool loadReplay(const char * path, std::vector<uint8_t> & data, uint32_t & frames) {
+    FILE * file = fopen(path, "rb");
+    if (file == NULL) return false;
+    uint8_t header[20];
+    bool ok = fread(header, 1, 20, file) == 20 && memcmp(header, "DKJR", 4) == 0;
+    if (ok) {
+        frames = header[12] | header[13] << 8 | header[14] << 16 | (uint32_t)header[15] << 24;
+        uint32_t size = header[16] | header[17] << 8 | header[18] << 16 | (uint32_t)header[19] << 24;
+        data.resize(size);
+        ok = size <= ReplayCapacity && fread(data.data(), 1, size, file) == size;
+    }
+    fclose(file);
+    return ok;
+}
+
+// -------------------------------------------------------------------------
+// Simulation
+// -------------------------------------------------------------------------
+
+struct Settings {
+    uint32_t             games;        // number of games to play
+    uint32_t             seed;         // seed of the first game
+    uint32_t             limit;        // maximum duration of a game (in frames)
+    Button               start;        // button that starts a game
+    std::vector<uint8_t> script;       // recorded session (or none for the random policy)
+    uint32_t             scriptFrames; // number of frames of the recorded session
+};
+
+struct Result {
+    uint16_t score;     // final score
+    uint32_t frames;    // duration of the game (in frames)
+    uint8_t  misses[3]; // number of failures by cause
+    bool     finished;  // indicates that the game ended before the limit
+};
+
+// plays one game from its beginning to its end
+static void play(const Settings & settings, uint32_t index, std::vector<uint8_t> & data, Result & result) {
+    uint32_t seed = settings.seed + index;
+    uint32_t total;
+
+    Replay replay(data.data(), data.size());
+    if (settings.script.empty()) {
+        total = StartFrame + settings.limit;
+        randomPolicy(replay, seed, total, settings.start);
+    } else {
+        total = settings.scriptFrames;
+        memcpy(data.data(), settings.script.data(), settings.script.size());
+        replay.load(settings.script.size(), total);
+    }
+    replay.seed  = seed;
+    replay.start = 0;
+
+    Game game;
+    game.play(&replay);
+
+    uint32_t frame = 0;
+    while (frame < total && game.getState() != GameState::Playing) {
+        game.step(1);
+        frame++;
+    }
+
+    uint32_t started = frame;
+    while (frame < total && frame - started < settings.limit && game.getState() == GameState::Playing) {
+        game.step(1);
+        frame++;
+    }
+
+    result.frames   = frame - started;
+    result.score    = game.getScore();
+    result.finished = started < total && game.getState() != GameState::Playing;
+    for (uint8_t i = 0; i < 3; i++) result.misses[i] = game.getMisses((MissCause)i);
+}
+
+// each thread takes the next game to be played until there are none left
+static void work(const Settings & settings, std::atomic<uint32_t> & next, std::vector<Result> & results) {
+    std::vector<uint8_t> data(ReplayCapacity);
+    uint32_t index;
+    while ((index = next++) < settings.games) {
+        play(settings, index, data, results[index]);
+    }
+}
+
+// -------------------------------------------------------------------------
+// Report
+// -------------------------------------------------------------------------
+
+static uint32_t percentile(const std::vector<uint32_t> & sorted, uint8_t p) {
+    return sorted[(sorted.size() - 1) * p / 100];
+}
+
+static void report(const Settings & settings, const std::vector<Result> & results) {
+    std::vector<uint32_t> scores, frames;
+    uint32_t misses[3] = {0, 0, 0};
+    uint32_t finished  = 0;
+    uint64_t scoreSum  = 0;
+    uint64_t frameSum  = 0;
+
+    for (const Result & result : results) {
+        if (!result.finished) continue;
+        finished++;
+        scores.push_back(result.score);
+        frames.push_back(result.frames);
+        scoreSum += result.score;
+        frameSum += result.frames;
+        for (uint8_t i = 0; i < 3; i++) misses[i] += result.misses[i];
+    }
+
+    printf("games: %u, finished: %u, stopped after %u frames: %u\n", settings.games, finished, settings.limit, settings.games - finished);
+    if (finished == 0) return;
+
+    std::sort(scores.begin(), scores.end());
+    std::sort(frames.begin(), frames.end());
+
+    printf("\n%-10s %10s %10s %10s %10s %10s %10s\n", "", "mean", "min", "p10", "p50", "p90", "max");
+    printf("%-10s %10.1f %10u %10u %10u %10u %10u\n", "score",
+        (double)scoreSum / finished, scores.front(), percentile(scores, 10), percentile(scores, 50), percentile(scores, 90), scores.back());
+    printf("%-10s %10.1f %10u %10u %10u %10u %10u\n", "frames",
+        (double)frameSum / finished, frames.front(), percentile(frames, 10), percentile(frames, 50), percentile(frames, 90), frames.back());
+    printf("%-10s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", "seconds",
+        (double)frameSum / finished / Game::FrameRate,
+        (double)frames.front() / Game::FrameRate,
+        (double)percentile(frames, 10) / Game::FrameRate,
+        (double)percentile(frames, 50) / Game::FrameRate,
+        (double)percentile(frames, 90) / Game::FrameRate,
+        (double)frames.back() / Game::FrameRate);
+
+    // the scores are grouped in at most 20 slices of equal width
+    uint32_t bucket = scores.back() / 20 + 1;
+    std::vector<uint32_t> histogram(scores.back() / bucket + 1, 0);
+    uint32_t highest = 0;
+    for (uint32_t score : scores) highest = std::max(highest, ++histogram[score / bucket]);
+
+    printf("\nscores\n");
+    for (uint32_t i = 0; i < histogram.size(); i++) {
+        uint32_t width = (histogram[i] * 50 + highest - 1) / highest;
+        printf("%5u-%-5u %8u  %s\n", i * bucket, (i + 1) * bucket - 1, histogram[i], std::string(width, '#').c_str());
+    }
+
+    static const char * causes[3] = { "bird", "croc", "fall" };
+    uint32_t total = misses[0] + misses[1] + misses[2];
+    printf("\nfailures\n");
+    for (uint8_t i = 0; i < 3; i++) {
+        printf("%-10s %8u  %5.1f%%\n", causes[i], misses[i], total ? 100.0 * misses[i] / total : 0.0);
+    }
+}
+
+// -------------------------------------------------------------------------
+// Entry point
+// -------------------------------------------------------------------------
+
+int main(int argc, char * argv[]) {
+    Settings     settings;
+    const char * replayPath = NULL;
+    uint32_t     threads    = std::thread::hardware_concurrency();
+
+    settings.games        = 1000;
+    settings.seed         = 1;
+    settings.limit        = 100000;
+    settings.start        = BUTTON_A;
+    settings.scriptFrames = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+             if (!strcmp(argv[i], "--seed")    && hasValue) settings.seed  = strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--threads") && hasValue) threads        = strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--limit")   && hasValue) settings.limit = strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--replay")  && hasValue) replayPath     = argv[++i];
+        else if (!strcmp(argv[i], "--game-b"))              settings.start = BUTTON_B;
+        else if (argv[i][0] != '-') settings.games = strtoul(argv[i], NULL, 10);
+        else {
+            fprintf(stderr, "usage: %s [--seed N] [--threads N] [--game-b] [--replay FILE] [--limit N] [games]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (replayPath && !loadReplay(replayPath, settings.script, settings.scriptFrames)) {
+        fprintf(stderr, "unable to read %s\n", replayPath);
+        return 1;
+    }
+
+    // a random game lasts a few minutes at most, and its recording
+    // must fit in the memory area allocated to each thread
+    if (!replayPath && settings.limit > ReplayCapacity / 4) settings.limit = ReplayCapacity / 4;
+    if (threads == 0) threads = 1;
+    if (settings.games == 0 || settings.limit == 0) {
+        fprintf(stderr, "nothing to simulate\n");
+        return 1;
+    }
+
+    std::vector<Result>      results(settings.games);
+    std::vector<std::thread> pool;
+    std::atomic<uint32_t>    next(0);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < threads; i++) {
+        pool.emplace_back(work, std::cref(settings), std::ref(next), std::ref(results));
+    }
+    for (std::thread & thread : pool) thread.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    printf("simulated: %u games on %u threads in %.3f s (%.0f games/s)\n", settings.games, threads, elapsed.count(), settings.games / elapsed.count());
+    report(settings, results);
+
+    return 0;
+}
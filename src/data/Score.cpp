@@ -1,7 +1,7 @@
 #include "Score.h"
-#include "../sounds/Buzzer.h"
 
-Score::Score() {
+Score::Score(Buzzer * buzzer) {
+    this->buzzer = buzzer;
     reset();
 }
 
@@ -25,7 +25,7 @@ void Score::reset() {
 void Score::inc(uint8_t amount) {
     if (amount == 1) {
         target = ++value;
-        Buzzer::play(Sound::Score);
+        buzzer->play(Sound::Score);
     } else {
         target += amount;
     }
@@ -38,7 +38,7 @@ bool Score::isIncreasing() {
 void Score::update() {
     if (value < target && gb.frameCount % 2 == 0) {
         value++;
-        Buzzer::play(Sound::Score);
+        buzzer->play(Sound::Score);
     }
 }
 
@@ -2,6 +2,7 @@
 #define DONKEY_KONG_JR_SCORE
 
 #include <Gamebuino-Meta.h>
+#include "../sounds/Buzzer.h"
 
 class Score
 {
@@ -12,6 +13,8 @@ class Score
         uint16_t highA;
         uint16_t highB;
 
+        Buzzer * buzzer;
+
     public:
 
         uint16_t getValue();
@@ -22,7 +25,7 @@ class Score
         bool isIncreasing();
         void reset();
 
-        Score();
+        Score(Buzzer * buzzer);
 
         void update();
         void load();
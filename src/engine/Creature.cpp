@@ -11,30 +11,24 @@
 // loads the header file of the class
 #include "Creature.h"
 
-// loads the sound effects manager
-#include "../sounds/Buzzer.h"
-
 // clears all enemies
 void Creature::reset() {
-    uint8_t i;
-    for (i=0; i<crocsSize; i++) crocs[i] = {false, false};
-    for (i=0; i<birdsSize; i++) birds[i] = {false, false};
+    crocs = {0, 0};
+    birds = {0, 0};
 }
 
 // any enemies in the vicinity of this position are deleted
 // to allow the player to restart from his starting position
 void Creature::clear() {
-    birds[0] = {false, false};
-    birds[1] = {false, false};
-    crocs[crocsSize - 1] = {false, false};
-    crocs[crocsSize - 2] = {false, false};
+    birds.exists &= ~0x3;
+    crocs.exists &= ~(0x3 << (CrocsSize - 2));
 }
 
 // attempts to destroy a bird at the specified position
 // and awards a reward in case of success
 void Creature::tryToKillBirdAt(uint8_t i) {
-    if (birds[i].exists) {
-        birds[i] = {false, false};
+    if (birds.exists & 1 << i) {
+        birds.exists &= ~(1 << i);
         score->inc(rewardWhenKilledBird);
     }
 }
@@ -42,8 +36,8 @@ void Creature::tryToKillBirdAt(uint8_t i) {
 // attempts to destroy a snapjaw at the specified position
 // and awards a reward in case of success
 void Creature::tryToKillCrocAt(uint8_t i) {
-    if (crocs[i].exists) {
-        crocs[i] = {false, false};
+    if (crocs.exists & 1 << i) {
+        crocs.exists &= ~(1 << i);
         if (i == 2) {
             score->inc(rewardWhenKilledTopCroc);
         } else if (i == 9) {
@@ -52,25 +46,37 @@ void Creature::tryToKillCrocAt(uint8_t i) {
     }
 }
 
-// determines the presence of a bird at the specified position
+// returns the positions occupied by birds (one bit per position)
+uint8_t Creature::getBirds() {
+    return birds.exists;
+}
+
+// returns the positions occupied by snapjaws (one bit per position)
+uint16_t Creature::getCrocs() {
+    return crocs.exists;
+}
+
+// determines the presence of a bird at one of the specified positions
 // and penalizes the player if he tries to cross this position
-bool Creature::isThereAnyBirdNearJunior(int8_t i) {
-    if (i != -1 && birds[i].exists) {
+bool Creature::isThereAnyBirdNearJunior(uint8_t positions) {
+    if (birds.exists & positions) {
         hasBittenJunior = true;
         bittenTime = gb.frameCount;
-        Buzzer::repeat(Sound::Lost, 5, 8);
+        biter = Enemy::Bird;
+        buzzer->repeat(Sound::Lost, 5, 8);
         return true;
     }
     return false;
 }
 
-// determines the presence of a snapjaw at the specified position
+// determines the presence of a snapjaw at one of the specified positions
 // and penalizes the player if he tries to cross this position
-bool Creature::isThereAnyCrocNearJunior(int8_t i) {
-    if (i != -1 && crocs[i].exists) {
+bool Creature::isThereAnyCrocNearJunior(uint16_t positions) {
+    if (crocs.exists & positions) {
         hasBittenJunior = true;
         bittenTime = gb.frameCount;
-        Buzzer::repeat(Sound::Lost, 5, 8);
+        biter = Enemy::Croc;
+        buzzer->repeat(Sound::Lost, 5, 8);
         return true;
     }
     return false;
@@ -89,7 +95,7 @@ void Creature::update(bool isPlaying) {
     if (!hasBittenJunior) updateCrocs();
 
     // emits a sound effect at each step of the enemies' progress
-    if (isPlaying && bip) Buzzer::play(Sound::Tick);
+    if (isPlaying && bip) buzzer->play(Sound::Tick);
 }
 
 // controls the progress of birds
@@ -111,10 +117,7 @@ void Creature::updateCrocs() {
 // examines the opportunity to make a new bird appear
 void Creature::spawnBird() {
     // counts the number of birds already present
-    uint8_t spawned = 0;
-    for (uint8_t i=0; i<birdsSize; i++) {
-        if (birds[i].exists) spawned++;
-    }
+    uint8_t spawned = __builtin_popcount(birds.exists);
 
     // determines the maximum number of birds that can
     // be present simultaneously on the game scene
@@ -122,10 +125,11 @@ void Creature::spawnBird() {
     maxBirds = maxBirds < 5 ? maxBirds : 4;
 
     // if the limit is not yet reached, a new bird may appear
-    if (spawned < maxBirds && random(4) == 0) {
-        if (!birds[0].exists) {
-            if (!birds[1].exists || birds[1].now != paceMaker) {
-                birds[0] = {true, paceMaker};
+    if (spawned < maxBirds && rng->below(4) == 0) {
+        if (!(birds.exists & 0x1)) {
+            if (!(ready(birds) & 0x2)) {
+                birds.exists |= 0x1;
+                birds.now     = (birds.now & ~0x1) | paceMaker;
                 bip = true;
             }
         }
@@ -135,10 +139,7 @@ void Creature::spawnBird() {
 // examines the opportunity to make a new snapjaw appear
 void Creature::spawnCroc() {
     // counts the number of snapjaws already present
-    uint8_t spawned = 0;
-    for (uint8_t i=0; i<crocsSize; i++) {
-        if (crocs[i].exists) spawned++;
-    }
+    uint8_t spawned = __builtin_popcount(crocs.exists);
 
     // determines the maximum number of snapjaws that can
     // be present simultaneously on the game scene
@@ -146,79 +147,73 @@ void Creature::spawnCroc() {
     maxCrocs = maxCrocs < 8 ? maxCrocs : 7;
 
     // if the limit is not yet reached, a new snapjaw may appear
-    if (spawned < maxCrocs && random(6) == 0) {
-        if (!crocs[0].exists) {
-            if (!crocs[1].exists || crocs[1].now != paceMaker) {
-                crocs[0] = {true, paceMaker};
+    if (spawned < maxCrocs && rng->below(6) == 0) {
+        if (!(crocs.exists & 0x1)) {
+            if (!(ready(crocs) & 0x2)) {
+                crocs.exists |= 0x1;
+                crocs.now     = (crocs.now & ~0x1) | paceMaker;
                 bip = true;
             }
         }
     }
 }
 
-// moves the birds forward and examines Junior's presence on their way
-void Creature::moveBirdForward(){
-    uint8_t i;
-    Beat    b;
+// positions of the enemies of a path whose presence is correlated
+// with the current beat of the metronome: these are the ones that move
+uint16_t Creature::ready(const Path & path) {
+    return path.exists & (paceMaker ? path.now : ~path.now);
+}
 
-    if (isPlaying) {
-        for (i=0; i<birdsSize; i++) {
+// moves all the enemies of a path that are ready a notch ahead, the ones
+// at the end of the path leaving it, and indicates if any of them moved
+bool Creature::advance(Path & path, uint8_t length) {
+    uint16_t end    = (1 << length) - 1;
+    uint16_t moving = ready(path);
+    uint16_t moved  = (moving << 1) & end;
+    uint16_t kept   = path.exists & ~moving & ~moved;
 
-            b = birds[i];
+    path.exists = kept | moved;
+    path.now    = (path.now & kept) | (paceMaker ? moved : 0);
 
-            // if Junior is spotted on his way, he gets bitten 
-            if (b.exists && b.now == paceMaker && bittenByBird[i] == junior->spriteIndex) {
-                hasBittenJunior = true;
-                bittenTime = gb.frameCount;
-                Buzzer::repeat(Sound::Lost, 5, 8);
-                return;
-            }
-            
-        }
+    return moved != 0;
+}
+
+// moves the birds forward and examines Junior's presence on their way
+void Creature::moveBirdForward(){
+    // if Junior is spotted on their way, he gets bitten
+    if (isPlaying && ready(birds) & collisions[junior->spriteIndex].birds) {
+        hasBittenJunior = true;
+        bittenTime = gb.frameCount;
+        biter = Enemy::Bird;
+        buzzer->repeat(Sound::Lost, 5, 8);
+        return;
     }
 
     // finally, we move all the birds a notch ahead
-
-    b = birds[birdsSize - 1];
-    if (b.exists && b.now == paceMaker) birds[birdsSize - 1] = {false, paceMaker};
-
-    for (i = birdsSize - 1; i > 0; i--) {
-        b = birds[i - 1];
-        if (b.exists && b.now == paceMaker) {
-            birds[i] = b;
-            birds[i - 1] = {false, paceMaker};
-            bip = true;
-        }
-    }
+    if (advance(birds, BirdsSize)) bip = true;
 }
 
 // moves the snapjaws forward and examines Junior's presence on their way
 void Creature::moveCrocForward(){
-    uint8_t scoring = 0;
-    uint8_t i;
-    Beat    b;
+    uint8_t  scoring = 0;
+    uint16_t moving  = ready(crocs);
 
     if (isPlaying) {
-        for (i=0; i<crocsSize; i++) {
 
-            b = crocs[i];
+        const Collision & collision = collisions[junior->spriteIndex];
 
-            // if Junior manages to avoid the enemy's advance by jumping, he is rewarded
-            if (b.exists && b.now == paceMaker) {
-                     if (i == 10 && junior->spriteIndex == BottomJump2 && junior->spriteLastIndex == Bottom2) scoring++;
-                else if (i ==  7 && junior->spriteIndex == BottomJump5 && junior->spriteLastIndex == Bottom5) scoring++;
-                else if (i ==  2 && junior->spriteIndex == TopJump2    && junior->spriteLastIndex == Top3)    scoring++;
-                else if (i ==  1 && junior->spriteIndex == TopJump3    && junior->spriteLastIndex == Top4)    scoring++;
-            }
+        // if Junior is spotted on their way, he gets bitten
+        if (moving & collision.crocs) {
+            hasBittenJunior = true;
+            bittenTime = gb.frameCount;
+            biter = Enemy::Croc;
+            buzzer->repeat(Sound::Lost, 5, 8);
+            return;
+        }
 
-            // if Junior is spotted on his way, he gets bitten 
-            if (b.exists && b.now == paceMaker && bittenByCroc[i] == junior->spriteIndex) {
-                hasBittenJunior = true;
-                bittenTime = gb.frameCount;
-                Buzzer::repeat(Sound::Lost, 5, 8);
-                return;
-            }
-            
+        // if Junior manages to avoid the enemy's advance by jumping, he is rewarded
+        if (junior->spriteLastIndex == collision.jumpedFrom) {
+            scoring = __builtin_popcount(moving & collision.dodgedCrocs);
         }
 
         // if a reward has been collected, it is added to the score
@@ -227,32 +222,8 @@ void Creature::moveCrocForward(){
         }
     }
 
-    // finally, we move all the snapjaws a notch ahead
-
-    b = crocs[crocsSize - 1];
-    if (b.exists && b.now == paceMaker) crocs[crocsSize - 1] = {false, paceMaker};
-
-    for (i = crocsSize - 1; i > 0; i--) {
-        b = crocs[i - 1];
-        if (b.exists && b.now == paceMaker) {
-            crocs[i] = b;
-            crocs[i - 1] = {false, paceMaker};
-            // disable sound effect when scoring because
-            // the increase in score already produces a series of sound effects
-            bip = !scoring;
-        }
-    }
+    // finally, we move all the snapjaws a notch ahead.
+    // the sound effect is disabled when scoring because
+    // the increase in score already produces a series of sound effects
+    if (advance(crocs, CrocsSize)) bip = !scoring;
 }
-
-// renders the sprites of all the enemies present on the current screen slice
-void Creature::drawSpritesOnSlice(Renderer * renderer, uint8_t sliceY, uint16_t * buffer) {
-    uint8_t i;
-    
-    for (i=0; i<crocsSize; i++) {
-        if (crocs[i].exists) renderer->drawSpriteOnSlice(crocSprite[i], sliceY, buffer);
-    }
-
-    for (i=0; i<birdsSize; i++) {
-        if (birds[i].exists) renderer->drawSpriteOnSlice(birdSprite[i], sliceY, buffer);
-    }
-}
\ No newline at end of file
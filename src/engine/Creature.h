@@ -20,24 +20,35 @@
 #define DONKEY_KONG_JR_CREATURE
 
 // loads external modules
-#include "../graphics/Renderer.h" // graphics rendering engine
 #include "../graphics/sprites.h"  // descriptive data of sprites
 #include "../player/Player.h"     // handles the player's avatar behaviour
 #include "../data/Score.h"        // handles the score and the saving of highscore
+#include "Random.h"               // generates the random numbers of the game
 
 // loads the official library
 #include <Gamebuino-Meta.h>
 
-// spatial-temporal descriptive unit
-// of the presence of an enemy
-struct Beat {
-    bool exists; // determines if the enemy exists at this position
-    bool now;    // determines if its presence is correlated with the metronome of the game engine
+// spatial-temporal description of the presence of the enemies along
+// their path, packed in one bit per position
+struct Path {
+    uint16_t exists; // positions where an enemy exists
+    uint16_t now;    // positions where its presence is correlated with the metronome of the game engine
+};
+
+// the kinds of enemies
+enum class Enemy : uint8_t {
+    Bird,
+    Croc
 };
 
 // the module definition
 class Creature
 {
+    public:
+
+        static constexpr uint8_t BirdsSize = 8;  // path length of the birds
+        static constexpr uint8_t CrocsSize = 13; // path length of the snapjaws
+
     private:
         
         // rewards obtained when Junior eliminates an enemy with the help of exotic fruit
@@ -45,11 +56,8 @@ class Creature
         static constexpr uint8_t rewardWhenKilledTopCroc    = 3;
         static constexpr uint8_t rewardWhenKilledBottomCroc = 9;
 
-        static constexpr uint8_t birdsSize = 8;  // path length of the birds
-        static constexpr uint8_t crocsSize = 13; // path length of the snapjaws
-
-        Beat   birds[birdsSize] = { {false, false} }; // positional bird array
-        Beat   crocs[crocsSize] = { {false, false} }; // positional snapjaw array
+        Path   birds = {0, 0}; // positions of the birds
+        Path   crocs = {0, 0}; // positions of the snapjaws
 
         bool   paceMaker; // synchronization indicator with the metronome of the game engine
         bool   bip;       // indicates whether a sound effect should be played when moving enemies
@@ -57,6 +65,8 @@ class Creature
 
         Player * junior;  // reference to the player's avatar
         Score  * score;   // reference to the score management module
+        Buzzer * buzzer;  // reference to the sound effects controller
+        Random * rng;     // reference to the random number generator of the game engine
 
         void updateBirds(); // controls bird progression
         void updateCrocs(); // controls snapjaw progression
@@ -67,36 +77,43 @@ class Creature
         void moveBirdForward(); // moves the birds forward
         void moveCrocForward(); // moves the snapjaws forward
 
+        uint16_t ready(const Path & path);             // positions of the enemies that move on this beat
+        bool     advance(Path & path, uint8_t length); // moves these enemies a notch ahead
+
     public:
 
         bool     hasBittenJunior; // indicates whether Junior has been bitten
         uint32_t bittenTime;      // the time at which it occurs
+        Enemy    biter;           // the kind of enemy that has bitten him
 
         // constructor
-        Creature(Player * player, Score * score) :
-            junior(player),
-            score(score),
+        Creature(Player * player, Score * score, Buzzer * buzzer, Random * rng) :
             paceMaker(false),
             bip(false),
             isPlaying(false),
+            junior(player),
+            score(score),
+            buzzer(buzzer),
+            rng(rng),
             hasBittenJunior(false),
-            bittenTime(0)
+            bittenTime(0),
+            biter(Enemy::Croc)
             {}
 
         void reset(); // clears all enemies
         void clear(); // deletes enemies too close to Junior's starting point
 
-        bool isThereAnyBirdNearJunior(int8_t i); // determines the presence of a bird at the specified position
-        bool isThereAnyCrocNearJunior(int8_t i); // determines the presence of a snapjaw at the specified position
+        bool isThereAnyBirdNearJunior(uint8_t positions);  // determines the presence of a bird at one of the specified positions
+        bool isThereAnyCrocNearJunior(uint16_t positions); // determines the presence of a snapjaw at one of the specified positions
 
         void tryToKillBirdAt(uint8_t i); // attempts to destroy a bird at the specified position
         void tryToKillCrocAt(uint8_t i); // attempts to destroy a snapjaw at the specified position
 
+        uint8_t  getBirds(); // returns the positions occupied by birds (one bit per position)
+        uint16_t getCrocs(); // returns the positions occupied by snapjaws (one bit per position)
+
         // controls the progress of enemies
         void update(bool isPlaying);
-
-        // renders the sprites of all the enemies present on the current screen slice
-        void drawSpritesOnSlice(Renderer * renderer, uint8_t sliceY, uint16_t * buffer);
 };
 
 #endif
\ No newline at end of file
@@ -51,7 +51,7 @@ void Fruit::update() {
     // if the fruit is not yet present on the game scene...
     else {
         // it is eventually made to appear
-        appeared    = random(24) == 0;
+        appeared    = rng->below(24) == 0;
         spriteIndex = 0;
     }
 }
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include "../player/Player.h"   // handles the player's avatar behaviour
 #include "../engine/Creature.h" // handles the enemies
 #include "../data/Score.h"      // handles the score and the saving of highscore
+#include "../engine/Random.h"   // generates the random numbers of the game
 
 #include <Gamebuino-Meta.h>
 
@@ -25,6 +26,7 @@ class Fruit
         Player   * player;   // reference to the player's avatar
         Creature * creature; // reference to the module which controls enemies
         Score    * score;    // reference to the score management module
+        Random   * rng;      // reference to the random number generator of the game engine
 
     public:
 
@@ -32,12 +34,13 @@ class Fruit
         uint8_t spriteIndex; // index of the image to display for sprite animation
 
         // constructor
-        Fruit(Player * player, Creature * creature, Score * score) :
-            appeared(false),
-            spriteIndex(0),
+        Fruit(Player * player, Creature * creature, Score * score, Random * rng) :
             player(player),
             creature(creature),
-            score(score)
+            score(score),
+            rng(rng),
+            appeared(false),
+            spriteIndex(0)
             {}
 
         void reset();  // resets the fruit state
@@ -14,7 +14,6 @@
 // loads external modules
 #include "../graphics/assets.h"  // loads the graphic resources
 #include "../graphics/sprites.h" // loads the description of all sprites
-#include "../sounds/Buzzer.h"    // loads the definition of the sound effects controller
 
 // -------------------------------------------------------------------------
 // Key swinging
@@ -26,11 +25,27 @@
 // in `src/graphics/sprites.h` by the `keySprite` array
 const uint8_t Game::keyFrame[keyFrames] = {0, 1, 2, 3, 3, 2, 1};
 
+// the whole game engine is allocated at once, as a global variable of
+// the sketch: its size is known at compile time, and must fit its budget
+// (unless the geometry of the renderer is being explored on the host)
+#ifndef RENDERER_IGNORE_RAM_BUDGET
+static_assert(sizeof(Renderer) <= Game::RamBudget, "the framebuffers exceed the RAM budget of the game engine");
+static_assert(sizeof(Game)     <= Game::RamBudget, "the game engine exceeds its RAM budget");
+#endif
+
 // -------------------------------------------------------------------------
 // Initialization
 // -------------------------------------------------------------------------
 
-Game::Game() {
+Game::Game() :
+    // the auxiliary modules are part of the game engine itself,
+    // so that no memory is allocated at runtime
+    score(&buzzer),
+    player(&buzzer),
+    creature(&player, &score, &buzzer, &rng),
+    fruit(&player, &creature, &score, &rng),
+    renderer(&profiler)
+{
     state        = GameState::Boot;
     type         = GameType::GameA;
     displayState = DisplayState::Score;
@@ -42,39 +57,101 @@ Game::Game() {
     // it is synchronized on the display frequency at the start
     // and therefore set to 1 second by default.
     // it will be gradually accelerated during the game.
-    tick        = FrameRate;
+    setTick(FrameRate);
 
     keyIndex    = 1;
     miss        = lives;
     unlocked    = 0;
     missChecked = false;
 
-    // instantiation of the auxiliary modules by dynamic memory allocation
-    score    = new Score();
-    player   = new Player();
-    creature = new Creature(player, score);
-    fruit    = new Fruit(player, creature, score);
-    renderer = new Renderer();
+    for (uint8_t i = 0; i < 3; i++) misses[i] = 0;
+
+    // the random sequence is the same at each start,
+    // unless another seed is chosen afterwards
+    seed        = 0;
+
+    // the game scene is rendered on every frame, until decided otherwise
+    decoupled    = false;
+    renderPeriod = 1;
+    renderFrame  = 0;
+    logicClock   = 0;
+
+    // the display stays on, until decided otherwise
+    idleTimeout  = 0;
+    activeFrame  = 0;
+    displayOff   = false;
+
+    // the colors of the background are taken from the original palette
+    palette     = STAGE_PALETTE;
+
+    // the boot screen is the first to be visible
+    captureScene(scene);
+    splitCounter(scene.counter);
 }
 
 void Game::setup() {
     // when the game engine is initialized, the scores saved
     // on the microSD are loaded into memory
-    score->load();
+    score.load();
 }
 
 // -------------------------------------------------------------------------
-// Destruction
+// Reproducibility
 // -------------------------------------------------------------------------
+// All the random draws of the game are made by the generator of the game
+// engine, and all the buttons are read through the input module. Given the
+// same seed, the same frame count and the same buttons, a session is
+// therefore always the same, and can be recorded to be replayed later.
+// -------------------------------------------------------------------------
+
+// restarts the random sequence of the game engine from a seed
+void Game::setSeed(uint32_t seed) {
+    this->seed = seed;
+    rng.seed(seed);
+}
 
-Game::~Game() {
-    // all modules instantiated by dynamic allocation must be properly destroyed
-    // to free the allocated memory
-    delete renderer;
-    delete fruit;
-    delete creature;
-    delete player;
-    delete score;
+// starts recording the session in a replay.
+// the recording must begin with a game engine that has just been created
+// and seeded, in order to be able to replay it later
+void Game::record(Replay * replay) {
+    replay->clear();
+    replay->seed  = seed;
+    replay->start = gb.frameCount;
+    input.record(replay);
+}
+
+// replays a recorded session: the game engine, which must have just been
+// created, is put back in the conditions of the beginning of the recording
+void Game::play(Replay * replay) {
+    replay->rewind();
+    setSeed(replay->seed);
+    gb.frameCount = replay->start;
+    input.play(replay);
+}
+
+// gives access to the frame times measured by the profiler
+Profiler * Game::getProfiler() {
+    return &profiler;
+}
+
+// gives access to the game scene that has been rendered last
+const Scene & Game::getScene() {
+    return scene;
+}
+
+// returns the console state
+GameState Game::getState() {
+    return state;
+}
+
+// returns the score of the current / last game
+uint16_t Game::getScore() {
+    return score.getValue();
+}
+
+// returns the number of failures due to a cause during the current / last game
+uint8_t Game::getMisses(MissCause cause) {
+    return misses[(uint8_t)cause];
 }
 
 // -------------------------------------------------------------------------
@@ -82,6 +159,136 @@ Game::~Game() {
 // -------------------------------------------------------------------------
 
 void Game::loop() {
+    // the buttons pressed by the player are read once for the whole frame
+    input.update();
+
+    // the display is switched off when nobody is playing anymore
+    watchActivity();
+
+    // the game progresses by one frame
+    update();
+
+    // and finally, we trigger the graphic
+    // rendering of the game scene
+    if (!decoupled) {
+        draw();
+    // unless the rendering is decoupled from the game logic: in this case,
+    // the frames that have been missed are caught up first, and the game
+    // scene is not rendered more often than required
+    } else {
+        catchUp();
+        if (gb.frameCount - renderFrame >= renderPeriod) {
+            renderFrame = gb.frameCount;
+            draw();
+        }
+    }
+
+    // the times measured during this frame are accounted
+    profiler.endFrame();
+}
+
+// advances the game logic by a number of frames, as fast as possible:
+// nothing is rendered, the frame rate is no longer respected, and the
+// sound effects are not played. the buttons of the META are not read
+// either, so that only a replay can interact with the game meanwhile
+void Game::step(uint32_t frames) {
+    buzzer.setSilent(true);
+    while (frames--) {
+        // the frame counter of the META is the time base of the whole game
+        gb.frameCount++;
+        input.update(false);
+        if (input.pressedAny()) activeFrame = gb.frameCount;
+        update();
+    }
+    buzzer.setSilent(false);
+
+    // the times measured meanwhile do not correspond to any rendered frame
+    profiler.cancelFrame();
+    // and the frames skipped at once do not count as an absence of the player
+    activeFrame = gb.frameCount;
+}
+
+// decouples the rendering from the game logic
+void Game::decouple(uint8_t fps) {
+    decoupled    = true;
+    renderPeriod = fps > 0 && fps < FrameRate ? FrameRate / fps : 1;
+    renderFrame  = gb.frameCount;
+    logicClock   = micros();
+}
+
+// runs the frames that have been missed, without rendering them.
+// the META waits for the beginning of each frame, but when a frame has
+// overrun its duration, the next ones are simply delayed: the game logic
+// keeps its own clock, and catches up as soon as it is one frame late
+void Game::catchUp() {
+    const uint32_t frameTime = 1000000 / FrameRate;
+
+    uint32_t now = micros();
+    logicClock  += frameTime;
+
+    int32_t late = now - logicClock;
+    // if the game logic is ahead of time, or if it is far too late (the
+    // console may have been paused), the clock is simply resynchronized
+    if (late < 0 || late >= (int32_t)(MaxCatchUp * frameTime)) {
+        logicClock = now;
+        return;
+    }
+    // otherwise, each missing frame is run without being rendered
+    // (the buttons have already been read for the current frame)
+    while (late >= (int32_t)frameTime) {
+        gb.frameCount++;
+        input.update(false);
+        if (input.pressedAny()) activeFrame = gb.frameCount;
+        update();
+        logicClock += frameTime;
+        late       -= frameTime;
+    }
+}
+
+// -------------------------------------------------------------------------
+// Power saving
+// -------------------------------------------------------------------------
+// The demonstration phase may run for hours on a console left on display.
+// The game scene hardly changes meanwhile (Junior moves once per beat, and
+// the counter every 4 seconds), and only what changes is rendered: most of
+// the frame is therefore spent waiting for the next one, during which the
+// CPU can sleep until the next interrupt. After a while without anyone
+// pressing a button, the display itself is switched off, until a button
+// is pressed again.
+// -------------------------------------------------------------------------
+
+// sets the inactivity delay of the demonstration phase
+void Game::setIdleTimeout(uint16_t seconds) {
+    idleTimeout = seconds;
+    activeFrame = gb.frameCount;
+}
+
+// lets the CPU sleep while waiting for the next frame
+void Game::idle() {
+    if (state == GameState::Demo) {
+        Profiler::Scope scope(&profiler, Phase::Sleep);
+        __WFI();
+    }
+}
+
+// switches the display off or on depending on the player activity
+void Game::watchActivity() {
+    if (input.pressedAny()) {
+        activeFrame = gb.frameCount;
+        // the button that wakes the console up has no other effect
+        if (displayOff) {
+            renderer.switchDisplay(true);
+            displayOff = false;
+            input.clear();
+        }
+    } else if (idleTimeout && !displayOff && state == GameState::Demo && gb.frameCount - activeFrame >= (uint32_t)idleTimeout * FrameRate) {
+        renderer.switchDisplay(false);
+        displayOff = true;
+    }
+}
+
+// controls the progress of the game during one frame
+void Game::update() {
     // we look at the state of the game engine
     // to apply the corresponding procedure and
     // monitor a possible interaction with the player
@@ -112,19 +319,24 @@ void Game::loop() {
         updateJuniorUnlocking();
         updateJuniorFalling();
         updateKey();
-        updateFruit();
-        updateCreature();
+        {
+            Profiler::Scope scope(&profiler, Phase::Fruit);
+            updateFruit();
+        }
+        {
+            Profiler::Scope scope(&profiler, Phase::Creature);
+            updateCreature();
+        }
         // but we disable the management of the score and
         // sound effects if the player is not playing
         if (state == GameState::Playing) {
-            score->update();
-            Buzzer::update();
+            score.update();
+            {
+                Profiler::Scope scope(&profiler, Phase::Sound);
+                buzzer.update();
+            }
         }
     }
-
-    // and finally, we trigger the graphic
-    // rendering of the game scene
-    draw();
 }
 
 // -------------------------------------------------------------------------
@@ -133,22 +345,22 @@ void Game::loop() {
 
 void Game::demo() {
     // with each metronome beat...
-    if (gb.frameCount % tick == 0) {
+    if (metronome.isDue(Beat::Demo, gb.frameCount)) {
         // during the demo phase, the evolution of the avatar
         // is simulated by a purely random behaviour
-        uint8_t r = random(4);
+        uint8_t r = rng.below(4);
         switch (r) {
             case 0:
-                player->move(moveLeft, false);
+                player.move(Direction::Left, false);
                 break;
             case 1:
-                player->move(moveRight, false);
+                player.move(Direction::Right, false);
                 break;
             case 2:
-                player->move(moveUp, false);
+                player.move(Direction::Up, false);
                 break;
             case 3:
-                player->move(moveDown, false);
+                player.move(Direction::Down, false);
                 break;
         }
     }
@@ -185,28 +397,22 @@ void Game::rollScore() {
 void Game::waitForSoundToggle() {
     // pressing the B button alternates between
     // turning sound effects on or off
-    if (gb.buttons.pressed(BUTTON_B)) {
-        Buzzer::toggleMute();
+    if (input.pressed(BUTTON_B)) {
+        buzzer.toggleMute();
     }
 }
 
 void Game::waitForDisplayToggle() {
     // pressing the MENU button alternates between the scores and
-    // the CPU load or available memory space.
+    // the CPU load or available memory space, then the average and
+    // maximum frame times of each phase measured by the profiler.
     // this feature was especially useful during the debugging phase,
     // but I finally kept it  🤓
-    if (gb.buttons.pressed(BUTTON_MENU)) {
-        switch (displayState) {
-            case DisplayState::Score:
-                displayState = DisplayState::CPU;
-                break;
-            case DisplayState::CPU:
-                displayState = DisplayState::RAM;
-                break;
-            case DisplayState::RAM:
-                displayState = DisplayState::Score;
-                break;
-        }
+    if (input.pressed(BUTTON_MENU)) {
+        // the pages follow each other in the order of their declaration
+        displayState = displayState == DisplayState::SleepRatio
+            ? DisplayState::Score
+            : (DisplayState)((uint8_t)displayState + 1);
     }
 }
 
@@ -214,8 +420,8 @@ void Game::waitForDisplayToggle() {
 // - either a Game A with A button
 // - or a Game B with B button
 void Game::waitForStarting() {
-         if (gb.buttons.pressed(BUTTON_A)) startGame(GameType::GameA);
-    else if (gb.buttons.pressed(BUTTON_B)) startGame(GameType::GameB);
+         if (input.pressed(BUTTON_A)) startGame(GameType::GameA);
+    else if (input.pressed(BUTTON_B)) startGame(GameType::GameB);
 }
 
 // during the playing phase, the player can move his avatar by pressing:
@@ -227,48 +433,50 @@ void Game::waitForStarting() {
 void Game::waitForMoving() {
     // if the avatar has been bitten by a snapjaw or a bird,
     // any movement is blocked
-    if (!creature->hasBittenJunior) {
+    if (!creature.hasBittenJunior) {
 
         // we are here in the **only** case where
         // the avatar can climb up along a vine
-        if (player->spriteIndex == Top4     &&
-            gb.buttons.pressed(BUTTON_LEFT) &&
-            gb.buttons.pressed(BUTTON_A)) {
-                player->grab();
+        if (player.spriteIndex == Top4     &&
+            input.pressed(BUTTON_LEFT) &&
+            input.pressed(BUTTON_A)) {
+                player.grab();
         }
 
         // from the moment the avatar has jumped to grab the unlocking key,
         // the player must no longer be able to control it
-        if (player->spriteIndex < GrabKey) {
+        if (player.spriteIndex < GrabKey) {
 
-            int8_t * direction = NULL;
+            Direction direction = Direction::None;
             
-                 if (gb.buttons.pressed(BUTTON_LEFT))                                       direction = (int8_t *)moveLeft;
-            else if (gb.buttons.pressed(BUTTON_RIGHT))                                      direction = (int8_t *)moveRight;
-            else if (gb.buttons.pressed(BUTTON_UP)   && player->spriteIndex == BottomJump6) direction = (int8_t *)moveUp;
-            else if (gb.buttons.pressed(BUTTON_A)    && player->spriteIndex != BottomJump6) direction = (int8_t *)moveUp;
-            else if (gb.buttons.pressed(BUTTON_DOWN) && !player->isJumping())               direction = (int8_t *)moveDown;
+                 if (input.pressed(BUTTON_LEFT))                                       direction = Direction::Left;
+            else if (input.pressed(BUTTON_RIGHT))                                      direction = Direction::Right;
+            else if (input.pressed(BUTTON_UP)   && player.spriteIndex == BottomJump6) direction = Direction::Up;
+            else if (input.pressed(BUTTON_A)    && player.spriteIndex != BottomJump6) direction = Direction::Up;
+            else if (input.pressed(BUTTON_DOWN) && !player.isJumping())               direction = Direction::Down;
 
-            if (direction != NULL) {
+            if (direction != Direction::None) {
 
                 // the player must not be able to cross the position occupied by an enemy!
 
+                const Collision & collision = collisions[player.spriteIndex];
+
                 if (
-                    direction == moveLeft && (
-                        creature->isThereAnyBirdNearJunior(bittenByBirdWhenMoveLeft[player->spriteIndex]) ||
-                        creature->isThereAnyCrocNearJunior(bittenByCrocWhenMoveLeft[player->spriteIndex])
+                    direction == Direction::Left && (
+                        creature.isThereAnyBirdNearJunior(collision.birdsLeft) ||
+                        creature.isThereAnyCrocNearJunior(collision.crocsLeft)
                     )
                 ) return;
 
                 else if (
-                    direction == moveRight && (
-                        creature->isThereAnyBirdNearJunior(bittenByBirdWhenMoveRight[player->spriteIndex]) ||
-                        creature->isThereAnyCrocNearJunior(bittenByCrocWhenMoveRight[player->spriteIndex])
+                    direction == Direction::Right && (
+                        creature.isThereAnyBirdNearJunior(collision.birdsRight) ||
+                        creature.isThereAnyCrocNearJunior(collision.crocsRight)
                     )
                 ) return;
 
                 // if this was not the case, then the movement is performed normally
-                player->move(direction);
+                player.move(direction);
             }
         }
 
@@ -294,55 +502,74 @@ void Game::startGame(GameType type) {
     state       = GameState::Playing;
     scoreState  = ScoreState::Score;
 
-    tick        = type == GameType::GameA ? FrameRate : 3 * FrameRate / 5;
+    setTick(type == GameType::GameA ? FrameRate : 3 * FrameRate / 5);
     miss        = 0;
     unlocked    = 0;
     missChecked = false;
 
-    score->reset();
-    creature->reset();
-    player->reset();
-    fruit->reset();
+    for (uint8_t i = 0; i < 3; i++) misses[i] = 0;
+
+    score.reset();
+    creature.reset();
+    player.reset();
+    fruit.reset();
+}
+
+// sets the beat of the metronome, from which
+// all the periodic events of the game derive
+void Game::setTick(uint8_t tick) {
+    this->tick = tick;
+    metronome.arm(Beat::Demo,     tick,      gb.frameCount);
+    metronome.arm(Beat::Key,      tick >> 1, gb.frameCount);
+    metronome.arm(Beat::Fruit,    tick >> 2, gb.frameCount);
+    metronome.arm(Beat::Creature, tick >> 1, gb.frameCount);
 }
 
 // stop of the current game
 void Game::stopGame() {
     state         = GameState::Demo;
     scoreRollTime = gb.frameCount;
-    tick          = FrameRate;
+    setTick(FrameRate);
 
     // the achieved score is eventually saved
     // on the microSD as a highscore
     switch (type) {
         case GameType::GameA:
-            score->saveA();
+            score.saveA();
             break;
         case GameType::GameB:
-            score->saveB();
+            score.saveB();
             break;
     }
 }
 
+// takes a failure into account
+void Game::countMiss(MissCause cause) {
+    miss++;
+    misses[(uint8_t)cause]++;
+    missChecked = true;
+}
+
 void Game::updateJuniorJumping() {
     // if the player has made a jump and has not been bitten in the same time,
     // the duration of the jump is controlled so that the avatar falls
     // to the ground after a short time
-    if (player->isJumping() && !creature->hasBittenJunior && gb.frameCount - player->timer > tick >> 1) {
+    if (player.isJumping() && !creature.hasBittenJunior && gb.frameCount - player.timer > tick >> 1) {
         // the `false` value indicates that the sound effect should not be played
-        player->move(moveDown, false);
+        player.move(Direction::Down, false);
     }
 }
 
 void Game::updateJuniorUnlocking() {
-    uint32_t elapsedTime = gb.frameCount - player->timer;
+    uint32_t elapsedTime = gb.frameCount - player.timer;
     // if the player is unlocking the cage...
-    if (player->isUnlocking()) {
+    if (player.isUnlocking()) {
         // and after a short break...
         if (elapsedTime > tick) {
             // if the avatar is about to insert the key into the lock...
-            if (player->hasArmUp()) {
+            if (player.hasArmUp()) {
                 // we calculate the time taken by the player to get there
-                uint32_t timeToUnlock = gb.frameCount - player->startupTime;
+                uint32_t timeToUnlock = gb.frameCount - player.startupTime;
                 uint8_t  scoring      = 0;
                 unlocked++;
                 // and then we calculate his reward accordingly
@@ -353,18 +580,18 @@ void Game::updateJuniorUnlocking() {
                 // he receives an additional reward
                 if (unlocked == cageParts) scoring += maxRewardUnlock;
                 // the score is updated (asynchronously)
-                score->inc(scoring);
+                score.inc(scoring);
                 // and we lower the avatar's arm to insert the key
-                player->unlock(ArmState::Down);
+                player.unlock(ArmState::Down);
             // otherwise, if the avatar was already in the key insertion position,
             // as soon as the score has finished updating...
-            } else if (player->hasArmDown() && !score->isIncreasing()) {
+            } else if (player.hasArmDown() && !score.isIncreasing()) {
                 // we lower the avatar down
-                player->comeDown();
+                player.comeDown();
             }
         }
     // if the avatar is already descending,
-    } else if (player->isComingDown()) {
+    } else if (player.isComingDown()) {
         // and after a short break...
         if (elapsedTime > tick) {
             // if all parts of the cage have been unlocked...
@@ -372,14 +599,14 @@ void Game::updateJuniorUnlocking() {
                 // the unlock counter is reset to zero
                 unlocked = 0;
                 // and the metronome beat is slightly accelerated
-                     if (type == GameType::GameA && tick > minTick) tick -= 2;
-                else if (type == GameType::GameB && tick > minTick) tick--;
+                     if (type == GameType::GameA && tick > minTick) setTick(tick - 2);
+                else if (type == GameType::GameB && tick > minTick) setTick(tick - 1);
             }
             // then the avatar returns to his starting position
-            player->reset();
+            player.reset();
             // and any enemies in the vicinity of this position are deleted
             // to allow the player to restart from his starting position
-            creature->clear();
+            creature.clear();
         }
     }
 }
@@ -389,27 +616,26 @@ void Game::updateJuniorUnlocking() {
 // - FallingUp   (the upper position of the fall)
 // - FallingDown (the lower position of the fall)
 void Game::updateJuniorFalling() {
-    uint32_t elapsedTime = gb.frameCount - player->timer;
+    uint32_t elapsedTime = gb.frameCount - player.timer;
     // if the player has finished his fall and the sound effect
     // of the failure has already been played...
-    if (player->isFallingDown() && Buzzer::hasRepeated) {
+    if (player.isFallingDown() && buzzer.hasRepeated) {
         // the avatar returns to his starting position
-        player->reset();
+        player.reset();
         // again, any enemies in the vicinity of this position
         // are deleted to allow the player to leave again
-        creature->clear();
+        creature.clear();
         missChecked = false;
         // if the number of failures reaches the fatal limit, the game ends
         if (miss == lives) stopGame();
     // otherwise, if the player has just started to fall...
-    } else if (player->isFallingUp() && elapsedTime > tick) {
+    } else if (player.isFallingUp() && elapsedTime > tick) {
         // after a short break, he moves on to the second phase of his fall
-        player->fall(FallState::Down);
+        player.fall(FallState::Down);
         // and if the failure has not yet been taken into account...
         if (!missChecked) {
             // it's time to do it!
-            miss++;
-            missChecked = true;
+            countMiss(MissCause::Fall);
         }
     }
 }
@@ -417,18 +643,18 @@ void Game::updateJuniorFalling() {
 // the key swings at the end of a branch,
 // until the player is able to grasp it
 void Game::updateKey() {
-    if (gb.frameCount % (tick >> 1) == 0) {
+    if (metronome.isDue(Beat::Key, gb.frameCount)) {
 
         // as soon as the player tries to grab it...
-        if (player->isGrabbing()) {
+        if (player.isGrabbing()) {
             // if it is in the right position...
             if (keyIndex == 0) {
                 // it is a success and the player enters the unlocking phase
-                player->unlock(ArmState::Up);
+                player.unlock(ArmState::Up);
             // otherwise...
             } else {
                 // it is a failure and the player enters the falling phase
-                player->fall(FallState::Up);
+                player.fall(FallState::Up);
                 missChecked = false;
             }
         }
@@ -442,35 +668,34 @@ void Game::updateKey() {
 // enemies evolve autonomously in the game
 void Game::updateCreature() {
     // if the player is in a potentially vulnerable situation in relation to his enemies...
-    if (!player->isUnlocking() && !player->isComingDown() && !player->isFalling()) {
+    if (!player.isUnlocking() && !player.isComingDown() && !player.isFalling()) {
 
         // if he has actually been bitten,
         // it is a failure and the corresponding
         // sound effect has been triggered...
-        if (creature->hasBittenJunior) {
+        if (creature.hasBittenJunior) {
 
-            uint32_t elapsedTime = gb.frameCount - creature->bittenTime;
+            uint32_t elapsedTime = gb.frameCount - creature.bittenTime;
 
             // as soon as the sound effect has ended...
-            if (Buzzer::hasRepeated) {
+            if (buzzer.hasRepeated) {
                 // we reset the situation for a new beginning,
                 // as in the case of a fall
-                creature->hasBittenJunior = false;
-                player->reset();
-                creature->clear();
+                creature.hasBittenJunior = false;
+                player.reset();
+                creature.clear();
                 missChecked = false;
                 // if the number of failures reaches the fatal limit, the game ends
                 if (miss == lives) stopGame();
             // otherwise, if the failure has not yet been taken into account...
             } else if (!missChecked) {
                 // it's time to do it!
-                miss++;
-                missChecked = true;
+                countMiss(creature.biter == Enemy::Bird ? MissCause::Bird : MissCause::Croc);
             }
         // and if the player has not been bitten...
-        } else if (gb.frameCount % (tick >> 1) == 0) {
+        } else if (metronome.isDue(Beat::Creature, gb.frameCount)) {
             // enemies continue to move normally
-            creature->update(state == GameState::Playing);
+            creature.update(state == GameState::Playing);
         }
     }
 }
@@ -479,8 +704,8 @@ void Game::updateCreature() {
 // defend himself from his enemies, but this procedure
 // is delegated to a specialized module
 void Game::updateFruit() {
-    if (gb.frameCount % (tick >> 2) == 0) {
-        fruit->update();
+    if (metronome.isDue(Beat::Fruit, gb.frameCount)) {
+        fruit.update();
     }
 }
 
@@ -528,146 +753,347 @@ void Game::updateFruit() {
 // -------------------------------------------------------------------------
 
 void Game::draw() {
-    // this is why we pass a callback reference to the game engine
-    // when we invoke the rendering engine
-    renderer->draw(this);
+    // nothing is rendered while the display is off: the last rendered
+    // scene is kept, and only what has changed will be drawn again
+    if (displayOff) return;
+    // what is visible on the game scene is captured once for all the slices
+    Scene next;
+    captureScene(next);
+    drawScene(next);
 }
 
-// this method will be used by the rendering engine to ask the game engine
-// to draw the elements of the game scene on the current slice
-void Game::drawOnSlice(uint8_t sliceY, uint16_t * buffer) {
-    // first, we draw the background scenery of the game scene
-    drawStageOnSlice(sliceY, buffer);
-    // and when we are no longer on the boot screen...
-    if (state != GameState::Boot) {
-        // we draw all the sprites present on the slice
-        drawSpritesOnSlice(sliceY, buffer);
-        creature->drawSpritesOnSlice(renderer, sliceY, buffer);
-        // and finally the score counter at the top right of the screen
-        drawScoreOnSlice(sliceY, buffer);
-    }
+// renders a given game scene: only the slices affected by a change
+// since the last rendering are recomputed and sent to the display device
+void Game::drawScene(const Scene & next) {
+    invalidateScene(next);
+    scene = next;
+    // nothing has to be rendered if the game scene has not changed
+    if (!renderer.isDirty()) return;
+    // the sprites to be drawn are listed once for all the slices
+    listSprites();
+    // this is why we pass a callback reference to the game engine
+    // when we invoke the rendering engine
+    renderer.draw(this);
 }
 
-// graphic rendering of the background scenery
-void Game::drawStageOnSlice(uint8_t sliceY, uint16_t * buffer) {
-    uint8_t w = Renderer::ScreenWidth;
-    // the graphical data of the background is determined
-    // according to whether we are in the boot phase or not
-    // (the background is not the same)
-    uint16_t * colormap = (uint16_t *)(state == GameState::Boot ? STAGE_COLORMAP + w * Renderer::ScreenHeight : STAGE_COLORMAP);
-    // the display of the background does not involve any transparent pixels.
-    // it is therefore much smarter and faster to proceed by copying
-    // memory blocks of bytes with the `memcpy` function of the C language.
-    memcpy(buffer, colormap + sliceY * w, 2 * w * Renderer::SliceHeight);
-}
-
-// graphic rendering of all sprites present on the slice
-void Game::drawSpritesOnSlice(uint8_t sliceY, uint16_t * buffer) {
+// determines what is visible on the game scene for the current frame
+void Game::captureScene(Scene & next) {
     uint8_t i;
+    // blinking elements are visible during the first half of each second
+    bool blink = gb.frameCount % FrameRate < FrameRate >> 1;
 
-    // Mario stands still no matter what happens
-    renderer->drawSpriteOnSlice(marioSprite, sliceY, buffer);
+    next.boot = state == GameState::Boot;
 
-    // if Junior has been bitten, apply a blinking effect,
-    // otherwise the sprite is drawn normally
-    if (!creature->hasBittenJunior || gb.frameCount % FrameRate < FrameRate >> 1) {
-        renderer->drawSpriteOnSlice(juniorSprite[player->spriteIndex], sliceY, buffer);
-    }
+    // if Junior has been bitten, apply a blinking effect
+    next.junior = !creature.hasBittenJunior || blink ? player.spriteIndex : Forbidden;
 
-    // draws the exotic fruit
-    if (fruit->appeared) {
-        renderer->drawSpriteOnSlice(fruitSprite[fruit->spriteIndex], sliceY, buffer);
-    }
+    // the exotic fruit
+    next.fruit = fruit.appeared ? fruit.spriteIndex : Forbidden;
 
-    // draws Junior's arm that unlocks the cage
-    if (player->isUnlocking()) {
-             if (player->hasArmUp())   renderer->drawSpriteOnSlice(juniorSprite[ArmUp], sliceY, buffer);
-        else if (player->hasArmDown()) renderer->drawSpriteOnSlice(juniorSprite[ArmDown], sliceY, buffer);
+    // Junior's arm that unlocks the cage
+    next.arm = Forbidden;
+    if (player.isUnlocking()) {
+             if (player.hasArmUp())   next.arm = ArmUp;
+        else if (player.hasArmDown()) next.arm = ArmDown;
     }
 
-    // draws the swinging key
-    if (!player->isUnlocking() && !player->isComingDown()) {
-        renderer->drawSpriteOnSlice(keySprite[keyFrame[keyIndex]], sliceY, buffer);
-    }
+    // the swinging key
+    next.key = !player.isUnlocking() && !player.isComingDown() ? keyFrame[keyIndex] : Forbidden;
 
-    // when Papa has been delivered...
-    if (unlocked == cageParts) {
-        // draws him smiling with blinking effect
-        if (gb.frameCount % FrameRate < FrameRate >> 1) {
-            renderer->drawSpriteOnSlice(smileSprite, sliceY, buffer);
-        }
-    // otherwise...
-    } else {
-        // draws the cage parts...
+    // when Papa has been delivered, he is smiling with blinking effect,
+    // otherwise the cage parts are visible with blinking effect on unlocked parts
+    next.smile = unlocked == cageParts && blink;
+    next.cage  = 0;
+    if (unlocked != cageParts) {
         for (i = 0; i < cageParts; i++) {
-            // with blinking effect on unlocked parts
-            if (i >= unlocked || gb.frameCount % FrameRate < FrameRate >> 1) {
-                renderer->drawSpriteOnSlice(cageSprite[i], sliceY, buffer);
-            }
+            if (i >= unlocked || blink) next.cage |= 1 << i;
         }
     }
 
-    // draws the game type information (Game A | Game B)
+    // the game type information (Game A | Game B)
+    next.info = Forbidden;
     if (state == GameState::Playing) {
-        renderer->drawSpriteOnSlice(infoSprite[type == GameType::GameA ? InfoGameA : InfoGameB], sliceY, buffer);
+        next.info = type == GameType::GameA ? InfoGameA : InfoGameB;
     } else if (state == GameState::Demo && displayState == DisplayState::Score) {
         switch (scoreState) {
             case ScoreState::HighScoreA:
-                renderer->drawSpriteOnSlice(infoSprite[InfoGameA], sliceY, buffer);
+                next.info = InfoGameA;
                 break;
             case ScoreState::HighScoreB:
-                renderer->drawSpriteOnSlice(infoSprite[InfoGameB], sliceY, buffer);
+                next.info = InfoGameB;
                 break;
         }
     }
 
-    // draws the missing lives (the failures)
-    if (miss) {
-        renderer->drawSpriteOnSlice(infoSprite[InfoMiss], sliceY, buffer);
-        for (i = 0; i < miss; i++) renderer->drawSpriteOnSlice(headSprite[i], sliceY, buffer);
-    }
-}
-
-// graphic rendering of the score counter
-void Game::drawScoreOnSlice(uint8_t sliceY, uint16_t * buffer) {
+    // the missing lives (the failures)
+    next.miss = miss;
 
-    // the value that will be displayed
-    uint16_t value;
+    // the enemies
+    next.birds = creature.getBirds();
+    next.crocs = creature.getCrocs();
 
+    // and the value displayed on the counter
     switch (displayState) {
         // if it is a question of displaying a score...
         case DisplayState::Score:
             switch (scoreState) {
                 // the value is the current score is displayed
                 case ScoreState::Score:
-                    value = score->getValue();
+                    next.counter = score.getValue();
                     break;
                 // the value is the best score is displayed for Game A
                 case ScoreState::HighScoreA:
-                    value = score->getHighA();
+                    next.counter = score.getHighA();
                     break;
                 // the value is the best score is displayed for Game B
                 case ScoreState::HighScoreB:
-                    value = score->getHighB();
+                    next.counter = score.getHighB();
                     break;
             }
             break;
         // otherwise, if we want to display the CPU load
         case DisplayState::CPU:
-            value = gb.getCpuLoad();
+            next.counter = gb.getCpuLoad();
             break;
         // otherwise, if we want to display the memory space still available
         case DisplayState::RAM:
-            value = gb.getFreeRam();
+            next.counter = gb.getFreeRam();
+            break;
+        // otherwise, a frame time measured by the profiler over the last
+        // second is displayed, each page showing a single statistic
+        case DisplayState::CreatureAvg:
+            next.counter = profiler.getAvg(Phase::Creature);
+            break;
+        case DisplayState::CreatureMax:
+            next.counter = profiler.getMax(Phase::Creature);
             break;
+        case DisplayState::FruitAvg:
+            next.counter = profiler.getAvg(Phase::Fruit);
+            break;
+        case DisplayState::FruitMax:
+            next.counter = profiler.getMax(Phase::Fruit);
+            break;
+        case DisplayState::ComposeAvg:
+            next.counter = profiler.getAvg(Phase::Compose);
+            break;
+        case DisplayState::ComposeMax:
+            next.counter = profiler.getMax(Phase::Compose);
+            break;
+        case DisplayState::StallAvg:
+            next.counter = profiler.getAvg(Phase::Stall);
+            break;
+        case DisplayState::StallMax:
+            next.counter = profiler.getMax(Phase::Stall);
+            break;
+        case DisplayState::SoundAvg:
+            next.counter = profiler.getAvg(Phase::Sound);
+            break;
+        case DisplayState::SoundMax:
+            next.counter = profiler.getMax(Phase::Sound);
+            break;
+        // or the share of the frames during which the CPU sleeps,
+        // which is as much time that the CPU does not consume
+        case DisplayState::SleepRatio:
+            next.counter = (uint32_t)profiler.getAvg(Phase::Sleep) * FrameRate / 10000;
+            break;
+    }
+}
+
+// marks the slices overlapped by the former and the new image of an
+// element of the game scene, if it has changed in the meantime
+static void invalidateSprite(Renderer & renderer, const Sprite * sprites, int8_t before, int8_t after) {
+    if (before == after) return;
+    if (before != Forbidden) renderer.invalidate(sprites[before]);
+    if (after  != Forbidden) renderer.invalidate(sprites[after]);
+}
+
+// marks the slices overlapped by the elements of a group that have
+// appeared or disappeared in the meantime (one bit per element)
+static void invalidateSprites(Renderer & renderer, const Sprite * sprites, uint16_t before, uint16_t after) {
+    uint16_t changes = before ^ after;
+    for (uint8_t i = 0; changes; i++, changes >>= 1) {
+        if (changes & 1) renderer.invalidate(sprites[i]);
+    }
+}
+
+// compares the new state of the game scene with the one that has been
+// rendered last, and marks the screen slices that must be redrawn
+void Game::invalidateScene(const Scene & next) {
+    // the digits of the counter are always kept up to date, but they
+    // are hidden on the boot screen, which must not be drawn over
+    if (next.counter != scene.counter) {
+        if (next.boot) splitCounter(next.counter);
+        else           invalidateCounter(next.counter);
+    }
+
+    // the background is not the same on the boot screen
+    if (next.boot != scene.boot) {
+        renderer.invalidateAll();
+        return;
+    }
+
+    invalidateSprite(renderer, juniorSprite, scene.junior, next.junior);
+    invalidateSprite(renderer, juniorSprite, scene.arm,    next.arm);
+    invalidateSprite(renderer, fruitSprite,  scene.fruit,  next.fruit);
+    invalidateSprite(renderer, keySprite,    scene.key,    next.key);
+    invalidateSprite(renderer, infoSprite,   scene.info,   next.info);
+
+    invalidateSprites(renderer, cageSprite, scene.cage,  next.cage);
+    invalidateSprites(renderer, birdSprite, scene.birds, next.birds);
+    invalidateSprites(renderer, crocSprite, scene.crocs, next.crocs);
+
+    if (next.smile != scene.smile) renderer.invalidate(smileSprite);
+
+    if (next.miss != scene.miss) {
+        invalidateSprites(renderer, headSprite, (1 << scene.miss) - 1, (1 << next.miss) - 1);
+        if (!next.miss || !scene.miss) renderer.invalidate(infoSprite[InfoMiss]);
+    }
+}
+
+// marks the digits of the counter that change: most of the time, only the
+// last one or two of them do, and only their blocks have to be redrawn.
+// when the number of digits changes, the whole counter is redrawn
+void Game::invalidateCounter(uint16_t value) {
+    uint8_t previous[Renderer::MaxDigits];
+    uint8_t count = digitCount;
+    memcpy(previous, digits, sizeof(digits));
+    splitCounter(value);
+    if (digitCount != count) {
+        renderer.invalidateCounter();
+        return;
+    }
+    for (uint8_t i = 0; i < digitCount; i++) {
+        if (digits[i] != previous[i]) renderer.invalidateDigit(i);
+    }
+}
+
+// this method will be used by the rendering engine to ask the game engine
+// to draw the elements of the game scene on the current slice
+void Game::drawOnSlice(uint8_t sliceY, uint16_t * buffer) {
+    // first, we draw the background scenery of the game scene
+    drawStageOnSlice(sliceY, buffer);
+    // and when we are no longer on the boot screen...
+    if (!scene.boot) {
+        // we draw all the sprites present on the slice
+        renderer.drawSpritesOnSlice(sliceY, buffer);
+        // and finally the score counter at the top right of the screen
+        drawScoreOnSlice(sliceY, buffer);
     }
+}
+
+// graphic rendering of the background scenery
+void Game::drawStageOnSlice(uint8_t sliceY, uint16_t * buffer) {
+    uint8_t w = Renderer::ScreenWidth;
+    // the background is stored as color indices: each of them is
+    // expanded into its RGB565 code by looking up the palette.
+    // the loop is unrolled, since a slice always has a multiple of 4 pixels
+    static_assert((Renderer::ScreenWidth * Renderer::SliceHeight) % 4 == 0, "a slice must have a multiple of 4 pixels");
+    const uint8_t * index = STAGE_BITMAP + sliceY * w;
+    uint16_t      * dest  = buffer;
+    uint16_t      * end   = buffer + w * Renderer::SliceHeight;
+    while (dest < end) {
+        dest[0] = palette[index[0]];
+        dest[1] = palette[index[1]];
+        dest[2] = palette[index[2]];
+        dest[3] = palette[index[3]];
+        dest  += 4;
+        index += 4;
+    }
+    // during the boot phase, the background is not the same:
+    // the pixels that differ from the stage are painted over it
+    if (scene.boot) drawBootOnSlice(sliceY, buffer);
+}
+
+// graphic rendering of the boot scene over the background scenery
+void Game::drawBootOnSlice(uint8_t sliceY, uint16_t * buffer) {
+    static_assert(sizeof(BOOT_ROWS) == (Renderer::ScreenHeight + 1) * sizeof(uint16_t), "the boot scene must describe every row of the screen");
+    uint8_t w = Renderer::ScreenWidth;
+    for (uint8_t y = sliceY; y < sliceY + Renderer::SliceHeight; y++) {
+        // each row is described by a sequence of runs of pixels,
+        // preceded by the number of pixels to be skipped and their length
+        const uint8_t * delta = BOOT_DELTA + BOOT_ROWS[y];
+        const uint8_t * end   = BOOT_DELTA + BOOT_ROWS[y + 1];
+        uint16_t      * dest  = buffer + (y - sliceY) * w;
+        while (delta < end) {
+            dest += *delta++;
+            uint8_t length = *delta++;
+            while (length--) *dest++ = palette[*delta++];
+        }
+    }
+}
+
+// builds the display list of all sprites present on the game scene
+void Game::listSprites() {
+    uint8_t i;
+
+    renderer.clearSprites();
+
+    // nothing but the background is visible on the boot screen
+    if (scene.boot) return;
+
+    // Mario stands still no matter what happens
+    renderer.addSprite(marioSprite);
+
+    // Junior, unless he is hidden by the blinking effect
+    if (scene.junior != Forbidden) renderer.addSprite(juniorSprite[scene.junior]);
+
+    // the exotic fruit
+    if (scene.fruit != Forbidden) renderer.addSprite(fruitSprite[scene.fruit]);
+
+    // Junior's arm that unlocks the cage
+    if (scene.arm != Forbidden) renderer.addSprite(juniorSprite[scene.arm]);
+
+    // the swinging key
+    if (scene.key != Forbidden) renderer.addSprite(keySprite[scene.key]);
+
+    // when Papa has been delivered, he is smiling
+    if (scene.smile) renderer.addSprite(smileSprite);
+
+    // the visible cage parts
+    for (i = 0; i < cageParts; i++) {
+        if (scene.cage & (1 << i)) renderer.addSprite(cageSprite[i]);
+    }
+
+    // the game type information (Game A | Game B)
+    if (scene.info != Forbidden) renderer.addSprite(infoSprite[scene.info]);
+
+    // the missing lives (the failures)
+    if (scene.miss) {
+        renderer.addSprite(infoSprite[InfoMiss]);
+        for (i = 0; i < scene.miss; i++) renderer.addSprite(headSprite[i]);
+    }
+
+    // the snapjaws and the birds
+    for (i = 0; i < Creature::CrocsSize; i++) {
+        if (scene.crocs & (1 << i)) renderer.addSprite(crocSprite[i]);
+    }
+    for (i = 0; i < Creature::BirdsSize; i++) {
+        if (scene.birds & (1 << i)) renderer.addSprite(birdSprite[i]);
+    }
+}
+
+// graphic rendering of the score counter
+void Game::drawScoreOnSlice(uint8_t sliceY, uint16_t * buffer) {
+    // the counter only occupies a few rows at the top of the screen,
+    // and most slices have nothing to do with it
+    if (sliceY >= Renderer::DigitY + Renderer::DigitHeight || sliceY + Renderer::SliceHeight <= Renderer::DigitY) return;
+    // each digit is displayed as a simple sprite
+    for (uint8_t i = 0; i < digitCount; i++) renderer.drawDigitOnSlice(digits[i], i, sliceY, buffer);
+}
+
+// graphic rendering of a digit of the counter on its own block
+void Game::drawDigitOnBlock(uint8_t index, uint16_t * buffer) {
+    renderer.drawDigitOnBlock(digits[index], buffer);
+}
 
-    // the number that represents the value to be displayed
-    // will be decomposed into digits, and each digit will be
-    // displayed as a simple sprite
-    String   s = String(value);
-    uint8_t  n = s.length();
-    for (uint8_t i = 0; i < n; i++) renderer->drawDigitOnSlice(s.charAt(i) - '0', n - i - 1, sliceY, buffer);
+// the number that represents the value to be displayed is decomposed
+// into digits once and for all the slices, as soon as it changes
+void Game::splitCounter(uint16_t value) {
+    digitCount = 0;
+    do {
+        digits[digitCount++] = value % 10;
+        value /= 10;
+    } while (value);
 }
 
 // -------------------------------------------------------------------------
@@ -675,10 +1101,10 @@ void Game::drawScoreOnSlice(uint8_t sliceY, uint16_t * buffer) {
 // but this technique is to be avoided because it's too CPU-intensive!  😂
 // -------------------------------------------------------------------------
 // void Game::drawScoreOnSlice(uint8_t sliceY, uint16_t * buffer) {
-//     uint16_t value = score->getValue();
+//     uint16_t value = score.getValue();
 //
 //     if (value == 0) {
-//         renderer->drawDigitOnSlice(0, 0, sliceY, buffer);
+//         renderer.drawDigitOnSlice(0, 0, sliceY, buffer);
 //         return;
 //     }
 //
@@ -691,6 +1117,6 @@ void Game::drawScoreOnSlice(uint8_t sliceY, uint16_t * buffer) {
 //         div = rem / pwr;
 //         rem -= div * pwr;
 //         size--;
-//         renderer->drawDigitOnSlice(div, size, sliceY, buffer);
+//         renderer.drawDigitOnSlice(div, size, sliceY, buffer);
 //     }
 // }
\ No newline at end of file
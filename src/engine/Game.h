@@ -14,9 +14,14 @@
 // loads external modules
 #include "Creature.h"              // handles birds and snapjaws (ennemies)
 #include "Fruit.h"                 // handles the use of exotic fruit as a defence
+#include "Metronome.h"             // schedules the periodic events of the game
+#include "Profiler.h"              // measures the time spent in each phase of a frame
+#include "Random.h"                // generates the random numbers of the game
+#include "../player/Input.h"       // reads the buttons pressed by the player
 #include "../player/Player.h"      // handles the player avatar behaviour
 #include "../graphics/Renderer.h"  // graphics rendering engine
 #include "../data/Score.h"         // handles the score and the saving of highscore
+#include "../sounds/Buzzer.h"      // plays the sound effects
 
 // loads the official library
 #include <Gamebuino-Meta.h>
@@ -39,7 +44,20 @@ enum class GameType : uint8_t {
 enum class DisplayState : uint8_t {
     Score,
     CPU,
-    RAM
+    RAM,
+    // average and maximum frame times measured by the profiler (in µs)
+    CreatureAvg,
+    CreatureMax,
+    FruitAvg,
+    FruitMax,
+    ComposeAvg,
+    ComposeMax,
+    StallAvg,
+    StallMax,
+    SoundAvg,
+    SoundMax,
+    // share of the frames during which the CPU sleeps (in %)
+    SleepRatio
 };
 
 // defines which score should be displayed
@@ -49,6 +67,31 @@ enum class ScoreState : uint8_t {
     HighScoreB  // high score for Game B
 };
 
+// defines the causes of a failure
+enum class MissCause : uint8_t {
+    Bird, // Junior has been bitten by a bird
+    Croc, // Junior has been bitten by a snapjaw
+    Fall  // Junior has missed the key and fallen
+};
+
+// compact description of everything that is visible on the game scene.
+// it is captured once per frame and compared with the previous one to
+// determine which screen slices actually need to be redrawn
+struct Scene {
+    bool     boot;    // the boot screen is displayed
+    int8_t   junior;  // Junior's posture (Forbidden when hidden by blinking)
+    int8_t   arm;     // Junior's arm posture when unlocking (Forbidden if none)
+    int8_t   fruit;   // animation stage of the fruit (Forbidden if absent)
+    int8_t   key;     // image of the swinging key (Forbidden if hidden)
+    uint8_t  cage;    // visible cage parts (one bit per part)
+    bool     smile;   // Papa is smiling
+    int8_t   info;    // game type indicator (Forbidden if none)
+    uint8_t  miss;    // number of failures
+    uint8_t  birds;   // bird positions (one bit per position)
+    uint16_t crocs;   // snapjaw positions (one bit per position)
+    uint16_t counter; // value displayed on the counter
+};
+
 // the game engine definition
 class Game
 {
@@ -74,26 +117,60 @@ class Game
         uint8_t  tick;        // number of frames corresponding to the beat of the metronome
         uint8_t  keyIndex;    // index of the current image for the animation of the unlocking key
         uint8_t  miss;        // number of failures
+        uint8_t  misses[3];   // number of failures of the current / last game by cause
         uint8_t  unlocked;    // number of cage parts that have been unlocked
         bool     missChecked; // flag indicating that the last failure has been taken into account
-
-        Score    * score;    // score management module
-        Player   * player;   // player avatar management module
-        Creature * creature; // ennemy management module
-        Fruit    * fruit;    // exotic fruit management module
-        Renderer * renderer; // graphics rendering engine
+        uint32_t seed;        // seed of the random sequence
+
+        // pacing of the game when the rendering is decoupled from the logic
+        bool     decoupled;    // the rendering is decoupled from the game logic
+        uint8_t  renderPeriod; // minimum number of frames between two renderings
+        uint32_t renderFrame;  // frame of the last rendering
+        uint32_t logicClock;   // timecode at which the current frame was due (in µs)
+
+        // power policy of the demonstration phase
+        uint16_t idleTimeout;  // inactivity delay before the display is switched off (in seconds, 0 if never)
+        uint32_t activeFrame;  // frame on which a button was pressed for the last time
+        bool     displayOff;   // the display has been switched off
+
+        // the auxiliary modules, in the order of their construction
+        // (each one only refers to the ones that precede it)
+        Profiler  profiler;  // frame-time profiler
+        Random    rng;       // pseudo-random number generator
+        Metronome metronome; // scheduler of the periodic events
+        Input     input;     // player input (buttons or replay)
+        Buzzer    buzzer;    // sound effects controller
+        Score     score;     // score management module
+        Player    player;    // player avatar management module
+        Creature  creature;  // ennemy management module
+        Fruit     fruit;     // exotic fruit management module
+        Renderer  renderer;  // graphics rendering engine
+
+        Scene scene; // visible state of the game scene at the last rendering
+
+        // the counter of the game scene, decomposed into digits each time it
+        // changes (from the units up to the highest digit)
+        uint8_t digits[Renderer::MaxDigits]; // the digits to be displayed
+        uint8_t digitCount;                  // the number of digits to be displayed
+
+        const uint16_t * palette; // color lookup table of the background (RGB565 code of each color index)
 
         // player interactions
         void waitForSoundToggle();   // monitors the activation or deactivation of sound effects
         void waitForDisplayToggle(); // monitors the display switchover at the counter (score | CPU | RAM)
         void waitForStarting();      // monitors the launch of a game
         void waitForMoving();        // monitors the behaviour of the player's avatar
+        void watchActivity();        // switches the display off or on depending on the player activity
 
+        void update();    // controls the progress of the game during one frame
+        void catchUp();   // runs the frames that have been missed, without rendering them
         void demo();      // controls the progress of the game during the demonstration phase
         void rollScore(); // controls the permutation of the information to be displayed on the counter
 
-        void startGame(GameType type); // launches a new game
-        void stopGame();               // ends the current game
+        void startGame(GameType type);   // launches a new game
+        void stopGame();                 // ends the current game
+        void countMiss(MissCause cause); // takes a failure into account
+        void setTick(uint8_t tick);      // sets the beat of the metronome
 
         void updateBootMode();        // controls the temporary boot phase
         void updateJuniorJumping();   // controls the player's avatar during a jump
@@ -104,8 +181,12 @@ class Game
         void updateFruit();           // controls the use of exotic fruit
 
         void draw();                                                // starts the graphic rendering of the game scene
+        void invalidateScene(const Scene & next);                   // marks the screen slices affected by the changes on the game scene
         void drawStageOnSlice(uint8_t sliceY, uint16_t * buffer);   // renders the graphic background of the game scene on the current screen slice
-        void drawSpritesOnSlice(uint8_t sliceY, uint16_t * buffer); // renders all sprites on the current screen slice
+        void drawBootOnSlice(uint8_t sliceY, uint16_t * buffer);    // renders the boot scene over the background on the current screen slice
+        void listSprites();                                         // builds the display list of all sprites present on the game scene
+        void splitCounter(uint16_t value);                          // decomposes the counter into the digits to be displayed
+        void invalidateCounter(uint16_t value);                     // marks the digits of the counter that change
         void drawScoreOnSlice(uint8_t sliceY, uint16_t * buffer);   // renders the score on the current screen slice
 
     public:
@@ -113,14 +194,61 @@ class Game
         // overall display frequency of the game
         static constexpr uint8_t FrameRate = 25;
 
-        Game();  // constructor
-        ~Game(); // destructor
+        // maximum number of frames that the game logic can catch up at once
+        static constexpr uint8_t MaxCatchUp = 4;
+
+        // RAM allotted to the whole game engine, framebuffers included
+        // (the engine does not allocate anything else at runtime)
+        static constexpr uint16_t RamBudget = 8 * 1024;
+
+        Game(); // constructor
 
         void setup(); // game engine initialization
         void loop();  // main control looop
 
+        // decouples the rendering from the game logic: the logic keeps its
+        // fixed rate, and catches up with the frames it has missed when the
+        // previous ones have overrun, while the game scene is rendered at
+        // most `fps` times per second, and only when it has changed
+        void decouple(uint8_t fps);
+
+        // sets the inactivity delay of the demonstration phase after which
+        // the display is switched off (0 to keep it always on)
+        void setIdleTimeout(uint16_t seconds);
+
+        // lets the CPU sleep while waiting for the next frame, if there
+        // is nothing else to do than the demonstration (to be called
+        // repeatedly until the next frame begins)
+        void idle();
+
+        // advances the game logic by a number of frames, without rendering
+        // or waiting, and without playing any sound effect
+        void step(uint32_t frames);
+
+        // makes a session reproducible
+        void setSeed(uint32_t seed);  // restarts the random sequence from a seed
+        void record(Replay * replay); // records the buttons pressed during the session
+        void play(Replay * replay);   // replays a recorded session
+
+        // determines what is visible on the game scene, without rendering it
+        void captureScene(Scene & next);
+        // renders a given game scene, whatever the state of the game engine
+        void drawScene(const Scene & next);
+
         // triggers the graphic rendering of the game scene on a slice of the screen
         void drawOnSlice(uint8_t sliceY, uint16_t * buffer);
+        // triggers the graphic rendering of a digit of the counter on its own block
+        void drawDigitOnBlock(uint8_t index, uint16_t * buffer);
+
+        // gives access to the frame times measured by the profiler
+        Profiler * getProfiler();
+        // gives access to the game scene that has been rendered last
+        const Scene & getScene();
+
+        // describes the progress of the current / last game
+        GameState getState();                 // returns the console state
+        uint16_t  getScore();                 // returns the score
+        uint8_t   getMisses(MissCause cause); // returns the number of failures due to a cause
 };
 
 #endif
\ No newline at end of file
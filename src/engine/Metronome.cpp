@@ -0,0 +1,48 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                                 Metronome
+// -------------------------------------------------------------------------
+
+// loads the header file of the class
+#include "Metronome.h"
+
+// constructor
+Metronome::Metronome() {
+    for (uint8_t i = 0; i < Beats; i++) {
+        period[i] = 1;
+        next[i]   = 0;
+    }
+}
+
+// finds the first frame, from a given one, on which an event is due.
+// this is the only division, and it only takes place when the event is
+// armed, or when the frames have not followed one another as expected
+void Metronome::align(uint8_t beat, uint32_t frame) {
+    uint8_t remainder = frame % period[beat];
+    next[beat] = remainder ? frame + period[beat] - remainder : frame;
+}
+
+// sets the period of an event
+void Metronome::arm(Beat beat, uint8_t period, uint32_t frame) {
+    uint8_t i = (uint8_t)beat;
+    this->period[i] = period ? period : 1;
+    align(i, frame);
+}
+
+// checks whether an event is due on a frame
+bool Metronome::isDue(Beat beat, uint32_t frame) {
+    uint8_t i = (uint8_t)beat;
+    // if the event has not been checked on the frames where it was due,
+    // or if the frame counter has been moved backwards (when a session is
+    // replayed), the next frame on which it is due must be found again
+    if (frame > next[i] || next[i] - frame >= period[i]) align(i, frame);
+    // otherwise, a single comparison is enough
+    if (frame != next[i]) return false;
+    next[i] += period[i];
+    return true;
+}
\ No newline at end of file
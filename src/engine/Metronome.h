@@ -0,0 +1,63 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                                 Metronome
+// -------------------------------------------------------------------------
+// The whole game is punctuated by the beat of the metronome: Junior moves
+// by himself during the demonstration on each beat, the key swings and the
+// enemies move on each half-beat, and the fruit falls on each quarter-beat.
+// 
+// Each of these rhythms is a periodic event, which occurs on the frames
+// whose number is a multiple of its period. Rather than dividing the frame
+// number by each period on every frame, the metronome remembers the next
+// frame on which each event is due, so that finding out whether it is due
+// is a mere comparison. The events are armed again with new periods when
+// the beat changes (at the start of a game or when the cage is unlocked).
+// -------------------------------------------------------------------------
+
+#ifndef DONKEY_KONG_JR_METRONOME
+#define DONKEY_KONG_JR_METRONOME
+
+// loads the official library
+#include <Gamebuino-Meta.h>
+
+// the periodic events of the game, in the order they are handled on a frame
+enum class Beat : uint8_t {
+    Demo,     // Junior moves by himself during the demonstration
+    Key,      // the key swings
+    Fruit,    // the fruit falls
+    Creature, // the enemies move
+    Count
+};
+
+// the class definition
+class Metronome
+{
+    private:
+
+        static constexpr uint8_t Beats = (uint8_t)Beat::Count;
+
+        uint8_t  period[Beats]; // period of each event (in number of frames)
+        uint32_t next[Beats];   // frame on which each event is due next
+
+        // finds the first frame, from a given one, on which an event is due
+        void align(uint8_t beat, uint32_t frame);
+
+    public:
+
+        Metronome(); // constructor
+
+        // sets the period of an event, which is then due on the frames
+        // whose number is a multiple of this period
+        void arm(Beat beat, uint8_t period, uint32_t frame);
+
+        // checks whether an event is due on a frame.
+        // each event must be checked at most once per frame
+        bool isDue(Beat beat, uint32_t frame);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                             Frame-Time Profiler
+// -------------------------------------------------------------------------
+
+// loads the header file of the class
+#include "Profiler.h"
+
+// the statistics are published as 16-bit values
+static uint16_t clamp(uint32_t value) {
+    return value > 0xffff ? 0xffff : value;
+}
+
+// -------------------------------------------------------------------------
+// Scoped timer
+// -------------------------------------------------------------------------
+
+Profiler::Scope::Scope(Profiler * profiler, Phase phase) {
+    this->profiler = profiler;
+    this->phase    = phase;
+    this->start    = micros();
+}
+
+Profiler::Scope::~Scope() {
+    profiler->add(phase, micros() - start);
+}
+
+// -------------------------------------------------------------------------
+// Initialization
+// -------------------------------------------------------------------------
+
+Profiler::Profiler() {
+    for (uint8_t i = 0; i < Phases; i++) {
+        elapsed[i] = 0;
+        low[i]     = 0xffffffff;
+        high[i]    = 0;
+        total[i]   = 0;
+        minTime[i] = 0;
+        avgTime[i] = 0;
+        maxTime[i] = 0;
+    }
+    frames  = 0;
+    windows = 0;
+}
+
+// -------------------------------------------------------------------------
+// Measurement
+// -------------------------------------------------------------------------
+
+void Profiler::add(Phase phase, uint32_t duration) {
+    elapsed[(uint8_t)phase] += duration;
+}
+
+// the times of the frame are accounted in the current window,
+// and the statistics are published when the window is completed
+void Profiler::endFrame() {
+    for (uint8_t i = 0; i < Phases; i++) {
+        if (elapsed[i] < low[i])  low[i]  = elapsed[i];
+        if (elapsed[i] > high[i]) high[i] = elapsed[i];
+        total[i]  += elapsed[i];
+        elapsed[i] = 0;
+    }
+
+    if (++frames < Window) return;
+
+    for (uint8_t i = 0; i < Phases; i++) {
+        minTime[i] = clamp(low[i]);
+        avgTime[i] = clamp(total[i] / Window);
+        maxTime[i] = clamp(high[i]);
+        low[i]     = 0xffffffff;
+        high[i]    = 0;
+        total[i]   = 0;
+    }
+    frames = 0;
+    windows++;
+}
+
+// forgets the times measured since the last frame
+void Profiler::cancelFrame() {
+    for (uint8_t i = 0; i < Phases; i++) elapsed[i] = 0;
+}
+
+// -------------------------------------------------------------------------
+// Statistics
+// -------------------------------------------------------------------------
+
+uint16_t Profiler::getMin(Phase phase) {
+    return minTime[(uint8_t)phase];
+}
+
+uint16_t Profiler::getAvg(Phase phase) {
+    return avgTime[(uint8_t)phase];
+}
+
+uint16_t Profiler::getMax(Phase phase) {
+    return maxTime[(uint8_t)phase];
+}
+
+uint32_t Profiler::getWindows() {
+    return windows;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                             Frame-Time Profiler
+// -------------------------------------------------------------------------
+// The CPU load given by `gb.getCpuLoad()` only tells how long the whole
+// frame took. The profiler measures separately the time spent in a few
+// phases of the frame, so that we know where it has gone.
+//
+// The measurement is done by scoped timers: a `Profiler::Scope` object
+// starts a timer when it is created, and adds the elapsed time to its phase
+// when it goes out of scope. The times are summed over each frame, then the
+// minimum, average and maximum frame times of each phase are computed over
+// successive windows of one second.
+// -------------------------------------------------------------------------
+
+#ifndef DONKEY_KONG_JR_PROFILER
+#define DONKEY_KONG_JR_PROFILER
+
+// loads the official library
+#include <Gamebuino-Meta.h>
+
+// the phases of a frame that are measured
+enum class Phase : uint8_t {
+    Creature, // interactions between the player's avatar and enemies
+    Fruit,    // use of exotic fruit
+    Compose,  // composition of the screen slices
+    Stall,    // waiting for the DMA transfers to be completed
+    Sound,    // sound effects controller
+    Sleep     // CPU asleep while waiting for the next frame
+};
+
+// the class definition
+class Profiler
+{
+    public:
+
+        static constexpr uint8_t Phases = 6;  // number of measured phases
+        static constexpr uint8_t Window = 25; // number of frames over which the statistics are computed
+
+    private:
+
+        uint32_t elapsed[Phases]; // time spent in each phase during the current frame (in µs)
+        uint32_t low[Phases];     // shortest frame time of each phase in the current window
+        uint32_t high[Phases];    // longest frame time of each phase in the current window
+        uint32_t total[Phases];   // total time spent in each phase in the current window
+        uint8_t  frames;          // number of frames already measured in the current window
+
+        // statistics of the last completed window (in µs)
+        uint16_t minTime[Phases];
+        uint16_t avgTime[Phases];
+        uint16_t maxTime[Phases];
+        uint32_t windows; // number of completed windows
+
+    public:
+
+        // scoped timer, which measures the time spent in a phase
+        // from its creation until it goes out of scope
+        class Scope
+        {
+            private:
+
+                Profiler * profiler;
+                Phase      phase;
+                uint32_t   start;
+
+            public:
+
+                Scope(Profiler * profiler, Phase phase);
+                ~Scope();
+        };
+
+        Profiler(); // constructor
+
+        void add(Phase phase, uint32_t duration); // adds some time spent in a phase
+        void endFrame();                          // closes the measurement of the current frame
+        void cancelFrame();                       // forgets the times measured since the last frame
+
+        uint16_t getMin(Phase phase); // shortest frame time of a phase in the last window (in µs)
+        uint16_t getAvg(Phase phase); // average frame time of a phase in the last window (in µs)
+        uint16_t getMax(Phase phase); // longest frame time of a phase in the last window (in µs)
+        uint32_t getWindows();        // number of completed windows
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,38 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                          Pseudo-Random Generator
+// -------------------------------------------------------------------------
+
+// loads the header file of the class
+#include "Random.h"
+
+// constructor
+Random::Random() {
+    seed(0);
+}
+
+// restarts the sequence from a seed.
+// the state of a xorshift generator must never be zero,
+// so the seed is mixed with an arbitrary odd constant
+void Random::seed(uint32_t seed) {
+    state = seed ^ 0x9e3779b9;
+    if (state == 0) state = 0x9e3779b9;
+}
+
+// returns the next number of the sequence
+uint32_t Random::next() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// returns a number between 0 and max - 1
+uint32_t Random::below(uint32_t max) {
+    return next() % max;
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                          Pseudo-Random Generator
+// -------------------------------------------------------------------------
+// The game engine owns its own pseudo-random number generator, rather than
+// relying on the global state of the Arduino `random()` function: given the
+// same seed, a game always unfolds in the same way, which makes it possible
+// to replay a recorded session exactly.
+//
+// The generator is a 32-bit xorshift, which only costs a few shifts and
+// exclusive-ors per number.
+// -------------------------------------------------------------------------
+
+#ifndef DONKEY_KONG_JR_RANDOM
+#define DONKEY_KONG_JR_RANDOM
+
+// loads the official library
+#include <Gamebuino-Meta.h>
+
+// the class definition
+class Random
+{
+    private:
+
+        uint32_t state; // internal state of the generator (never zero)
+
+    public:
+
+        Random(); // constructor
+
+        void     seed(uint32_t seed);  // restarts the sequence from a seed
+        uint32_t next();               // returns the next number of the sequence
+        uint32_t below(uint32_t max);  // returns a number between 0 and max - 1
+};
+
+#endif
\ No newline at end of file
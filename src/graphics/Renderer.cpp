@@ -16,30 +16,41 @@
 #include "../engine/Game.h" // loads the definition of the game engine
 
 // preparation related to the DMA controller of the display device
+// (the stand-in of the host build models the transfers on its own)
 namespace Gamebuino_Meta {
+#ifndef GAMEBUINO_HOST
     #define DMA_DESC_COUNT 3
     extern volatile uint32_t dma_desc_free_count;
     static inline void wait_for_transfers_done(void) {
         while (dma_desc_free_count < DMA_DESC_COUNT);
     }
+    static inline bool is_transfer_done(void) {
+        return dma_desc_free_count == DMA_DESC_COUNT;
+    }
+#endif
     static SPISettings tftSPISettings = SPISettings(24000000, MSBFIRST, SPI_MODE0);
 };
 
+// commands of the ST7735 controller of the display device
+#define ST7735_DISPOFF 0x28
+#define ST7735_DISPON  0x29
+
 // constructor
-Renderer::Renderer() {
-    buffer1 = new uint16_t[ScreenWidth * SliceHeight];
-    buffer2 = new uint16_t[ScreenWidth * SliceHeight];
+template <uint8_t Height, uint8_t Count>
+SliceRenderer<Height, Count>::SliceRenderer(Profiler * profiler) {
+    this->profiler = profiler;
+    queueStart  = 0;
+    queueSize   = 0;
     drawPending = false;
-}
-
-// destructor
-Renderer::~Renderer() {
-    delete buffer2;
-    delete buffer1;
+    spriteCount = 0;
+    dirtyDigits = 0;
+    // nothing has been displayed yet
+    invalidateAll();
 }
 
 // initiates memory forwarding to the DMA controller
-void Renderer::customDrawBuffer(uint8_t x, uint8_t y, uint16_t * buffer, uint8_t w, uint8_t h) {
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::customDrawBuffer(uint8_t x, uint8_t y, uint16_t * buffer, uint8_t w, uint8_t h) {
     drawPending = true;
     gb.tft.setAddrWindow(x, y, x + w - 1, y + h - 1);
     SPI.beginTransaction(Gamebuino_Meta::tftSPISettings);
@@ -49,8 +60,11 @@ void Renderer::customDrawBuffer(uint8_t x, uint8_t y, uint16_t * buffer, uint8_t
 
 // waits for the memory transfer to be completed
 // and close the transaction with the DMA controller
-void Renderer::waitForPreviousDraw() {
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::waitForPreviousDraw() {
     if (drawPending) {
+        // the time the CPU spends waiting here is lost for the composition
+        Profiler::Scope scope(profiler, Phase::Stall);
         Gamebuino_Meta::wait_for_transfers_done();
         gb.tft.idleMode();
         SPI.endTransaction();
@@ -58,6 +72,143 @@ void Renderer::waitForPreviousDraw() {
     }
 }
 
+// releases the framebuffer whose transfer is completed, and starts
+// the transfer of the next one (waiting for it if requested)
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::sendQueue(bool wait) {
+    if (drawPending) {
+        // the DMA controller is still busy with the oldest framebuffer,
+        // and the CPU has better things to do than waiting for it
+        if (!wait && !Gamebuino_Meta::is_transfer_done()) return;
+        waitForPreviousDraw();
+        // the oldest framebuffer is free again
+        queueStart = (queueStart + 1) % Buffers;
+        queueSize--;
+    }
+    // the next framebuffer of the queue takes its turn
+    if (queueSize) customDrawBuffer(0, queueY[queueStart], buffers[queueStart], ScreenWidth, SliceHeight);
+}
+
+// switches the display device on or off.
+// the controller keeps the image in its memory meanwhile, so that
+// nothing has to be redrawn when the display is switched back on
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::switchDisplay(bool on) {
+    SPI.beginTransaction(Gamebuino_Meta::tftSPISettings);
+    gb.tft.commandMode();
+    SPI.transfer(on ? ST7735_DISPON : ST7735_DISPOFF);
+    gb.tft.idleMode();
+    SPI.endTransaction();
+}
+
+// -------------------------------------------------------------------------
+// Invalidation of screen slices
+// -------------------------------------------------------------------------
+// On a Game & Watch screen, most of the scene remains unchanged from one
+// frame to the next. The game engine therefore indicates which areas of
+// the screen have changed since the last rendering, and only the slices
+// they overlap are recomputed and transmitted to the display device.
+// The other slices keep on the screen the image that was sent previously.
+// -------------------------------------------------------------------------
+
+// marks the slices overlapped by a horizontal band of the screen
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::invalidateRows(uint8_t y, uint8_t height) {
+    if (height == 0) return;
+    uint8_t first = y / SliceHeight;
+    uint8_t last  = (y + height - 1) / SliceHeight;
+    for (uint8_t i = first; i <= last && i < Slices; i++) dirtySlices |= 1UL << i;
+}
+
+// marks the slices overlapped by a sprite
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::invalidate(const Sprite & sprite) {
+    dirtySlices |= sprite.slices;
+}
+
+// marks the slices overlapped by the counter
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::invalidateCounter() {
+    invalidateRows(DigitY, DigitHeight);
+}
+
+// marks the block of a digit of the counter: when only a few digits of
+// the counter change (which is the case when the score increases), they
+// can be redrawn on their own, without touching the rest of their slices
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::invalidateDigit(uint8_t index) {
+    dirtyDigits |= 1 << index;
+}
+
+// marks all the slices
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::invalidateAll() {
+    dirtySlices = Slices == 32 ? 0xffffffff : (1UL << Slices) - 1;
+}
+
+// indicates whether any slice will have to be redrawn
+template <uint8_t Height, uint8_t Count>
+bool SliceRenderer<Height, Count>::isDirty() {
+    return dirtySlices || dirtyDigits;
+}
+
+// -------------------------------------------------------------------------
+// Display list
+// -------------------------------------------------------------------------
+// Rather than asking every sprite of the game scene whether it overlaps
+// each slice, the game engine builds once per rendering the list of the
+// sprites to be drawn. The list is then sorted into buckets, one per slice,
+// according to the rows covered by each sprite, so that the composition of
+// a slice only goes through the sprites that actually overlap it.
+// -------------------------------------------------------------------------
+
+// empties the display list
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::clearSprites() {
+    spriteCount = 0;
+}
+
+// adds a sprite to the display list
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::addSprite(const Sprite & sprite) {
+    if (spriteCount < MaxSprites) sprites[spriteCount++] = &sprite;
+}
+
+// sorts the sprites of the display list into the slice buckets.
+// this is a counting sort: the size of each bucket is counted first,
+// then each sprite index is written in all the buckets it belongs to
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::sortSprites() {
+    uint8_t next[Slices];
+    uint8_t i, j;
+
+    memset(bucketStart, 0, sizeof(bucketStart));
+
+    for (i = 0; i < spriteCount; i++) {
+        for (j = sprites[i]->first; j <= sprites[i]->last && j < Slices; j++) bucketStart[j + 1]++;
+    }
+
+    for (j = 0; j < Slices; j++) {
+        bucketStart[j + 1] += bucketStart[j];
+        next[j] = bucketStart[j];
+    }
+
+    for (i = 0; i < spriteCount; i++) {
+        for (j = sprites[i]->first; j <= sprites[i]->last && j < Slices; j++) buckets[next[j]++] = i;
+    }
+}
+
+// renders the sprites of the display list that overlap the current screen slice
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::drawSpritesOnSlice(uint8_t sliceY, uint16_t * buffer) {
+    uint8_t sliceIndex = sliceY / SliceHeight;
+    for (uint8_t i = bucketStart[sliceIndex]; i < bucketStart[sliceIndex + 1]; i++) {
+        const Sprite & sprite = *sprites[buckets[i]];
+        // the rows of the sprite on the slice are read from its index
+        drawSpriteOnSlice(sprite, sprite.bands[sliceIndex - sprite.first], buffer);
+    }
+}
+
 // -------------------------------------------------------------------------
 // Graphic rendering
 // -------------------------------------------------------------------------
@@ -102,74 +253,131 @@ void Renderer::waitForPreviousDraw() {
 // -------------------------------------------------------------------------
 
 // starts the graphic rendering of the game scene
-void Renderer::draw(Game * engine) {
-    // the number of horizontal slices to be cut is calculated
-    uint8_t slices = ScreenHeight / SliceHeight;
-    // declares a pointer that will alternate between the two memory buffers
-    uint16_t * buffer;
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::draw(Game * engine) {
+    // declares the index of the framebuffer of the current slice
+    uint8_t slot;
     // declares the top border of current slice
     uint8_t sliceY;
+    // the sprites to be drawn are distributed among the slices
+    if (dirtySlices) {
+        Profiler::Scope scope(profiler, Phase::Compose);
+        sortSprites();
+    }
     // then we go through each slice one by one
-    for (uint8_t sliceIndex = 0; sliceIndex < slices; sliceIndex++) {
-        // buffers are switched according to the parity of sliceIndex
-        buffer = sliceIndex % 2 == 0 ? buffer1 : buffer2;
+    for (uint8_t sliceIndex = 0; sliceIndex < Slices; sliceIndex++) {
+        // the slices that have not changed since the last rendering are skipped
+        if (!(dirtySlices & (1UL << sliceIndex))) continue;
+        // if all the framebuffers are waiting to be sent, we have no
+        // choice but to wait for the oldest one to be transferred
+        if (queueSize == Buffers) sendQueue(true);
+        // the first free framebuffer follows the queue
+        slot = (queueStart + queueSize) % Buffers;
         // the top border of the current slice is calculated
         sliceY = sliceIndex * SliceHeight;
 
         // delegates the slice rendering to the game engine
-        engine->drawOnSlice(sliceY, buffer);
+        {
+            Profiler::Scope scope(profiler, Phase::Compose);
+            engine->drawOnSlice(sliceY, buffers[slot]);
+        }
 
-        // then we make sure that the sending of the previous buffer
-        // to the DMA controller has taken place
-        if (sliceIndex != 0) waitForPreviousDraw();
-        // after which we can then send the current buffer
-        customDrawBuffer(0, sliceY, buffer, ScreenWidth, SliceHeight);
+        // then the framebuffer joins the queue,
+        // and is sent as soon as the DMA controller is available
+        queueY[slot] = sliceY;
+        queueSize++;
+        sendQueue(false);
     }
 
-    // always wait until the DMA transfer is completed
-    // for the last slice before entering the next cycle
+    // always wait until the DMA transfers are completed
+    // for the last slices before entering the next cycle
+    while (queueSize) sendQueue(true);
+
+    // the digits of the counter that have changed on their own are then
+    // redrawn, unless their slices have all just been redrawn entirely
+    const uint32_t counterSlices = (2UL << (DigitY + DigitHeight - 1) / SliceHeight) - (1UL << DigitY / SliceHeight);
+    if (dirtyDigits && (dirtySlices & counterSlices) != counterSlices) drawDigits(engine);
+
+    // the screen is now up to date
+    dirtySlices = 0;
+    dirtyDigits = 0;
+}
+
+// renders the digits of the counter that have changed, each one on its own
+// block, which is sent alone to the display device (a few dozen pixels
+// rather than two whole slices)
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::drawDigits(Game * engine) {
+    uint16_t * buffer;
+    uint8_t    sent = 0;
+    for (uint8_t index = 0; index < MaxDigits; index++) {
+        if (!(dirtyDigits & (1 << index))) continue;
+        buffer = buffers[sent++ % Buffers];
+        {
+            Profiler::Scope scope(profiler, Phase::Compose);
+            engine->drawDigitOnBlock(index, buffer);
+        }
+        waitForPreviousDraw();
+        customDrawBuffer(DigitX - index * (DigitWidth + DigitOffset), DigitY, buffer, DigitWidth, DigitHeight);
+    }
     waitForPreviousDraw();
 }
 
-// renders a specific sprite on the current screen slice
-void Renderer::drawSpriteOnSlice(Sprite sprite, uint8_t sliceY, uint16_t * buffer) {
-    // we check first of all that the intersection between
-    // the sprite and the current slice is not empty
-    if (sliceY < sprite.y + sprite.height && sprite.y < sliceY + SliceHeight) {
-        // determines the boundaries of the sprite surface within the current slice
-        uint8_t  xmin = sprite.x;
-        uint8_t  xmax = sprite.x + sprite.width - 1;
-        uint8_t  ymin = sprite.y < sliceY ? sliceY : sprite.y;
-        uint8_t  ymax = sprite.y + sprite.height >= sliceY + SliceHeight ? sliceY + SliceHeight - 1 : sprite.y + sprite.height - 1;
-
-        // uint8_t  px, py;
-        uint16_t syo, dyo;
-        uint16_t color;
-        // goes through the sprite pixels to be drawn
-        for (uint8_t py = ymin; py <= ymax; py++) {
-            // calculates the y offset on source and destination
-            syo = py * ScreenWidth;
-            dyo = (py - sliceY) * ScreenWidth;
-            for (uint8_t px = xmin; px <= xmax; px++) {
-                // picks the pixel color from the spritesheet
-                color = SPRITESHEET_COLORMAP[px + syo];
-                // and if it belongs to the sprite
-                if (color == sprite.color) {
-                    // plots a black pixel into the rendering buffer
-                    buffer[px + dyo] = 0x0000;
-                }
+// renders a specific sprite on the current screen slice.
+// the rows of the sprite that lie on the slice have been determined at
+// compile time, so that there is nothing left to do but to draw them.
+// each row of the sprite is packed into a 32-bit word, one bit per pixel,
+// so that a single read of the mask is enough to draw a whole row
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::drawSpriteOnSlice(const Sprite & sprite, const SpriteBand & band, uint16_t * buffer) {
+    const uint32_t * mask = sprite.mask + band.mask;
+    uint16_t       * row  = buffer + band.row * ScreenWidth + sprite.x;
+    uint16_t       * dest;
+    uint32_t         bits;
+
+    // goes through the sprite rows to be drawn
+    for (uint8_t rows = band.rows; rows; rows--, row += ScreenWidth) {
+        dest = row;
+        // reads the whole row of the mask at once
+        bits = *mask++;
+        // then plots a black pixel for each bit set, from left to right,
+        // until no more pixels remain to be drawn on the row
+        while (bits) {
+            // empty blocks of 8 pixels are skipped at once
+            if (!(bits & 0xff)) {
+                bits >>= 8;
+                dest  += 8;
+                continue;
             }
+            if (bits & 1) *dest = 0x0000;
+            bits >>= 1;
+            dest++;
         }
     }
 }
 
+// the image of each digit, at the top of its column in the digits spritesheet
+static constexpr const uint16_t * digitGlyph[] = {
+    DIGIT_COLORMAP + 0 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 1 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 2 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 3 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 4 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 5 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 6 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 7 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 8 * Renderer::DigitWidth,
+    DIGIT_COLORMAP + 9 * Renderer::DigitWidth
+};
+
 // renders a specific digit on the current screen slice.
 // here the framebuffer writing is not done pixel by pixel,
 // but by blocks of pixels to speed up the processing
-void Renderer::drawDigitOnSlice(uint8_t digit, uint8_t index, uint8_t sliceY, uint16_t * buffer) {
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::drawDigitOnSlice(uint8_t digit, uint8_t index, uint8_t sliceY, uint16_t * buffer) {
     // calculates the coordinates of the sprite
-    uint8_t dx = 149 - index * (DigitWidth + DigitOffset);
-    uint8_t dy = 6;
+    uint8_t dx = DigitX - index * (DigitWidth + DigitOffset);
+    uint8_t dy = DigitY;
 
     // we check first of all that the intersection between
     // the sprite and the current slice is not empty
@@ -178,7 +386,7 @@ void Renderer::drawDigitOnSlice(uint8_t digit, uint8_t index, uint8_t sliceY, ui
         uint8_t ymin = dy < sliceY ? sliceY : dy;
         uint8_t ymax = dy + DigitHeight >= sliceY + SliceHeight ? sliceY + SliceHeight - 1 : dy + DigitHeight - 1;
         // determines the memory address of the byte block to be copied
-        uint16_t * source = (uint16_t *)DIGIT_COLORMAP + digit * DigitWidth;
+        const uint16_t * source = digitGlyph[digit];
         // determines the destination memory address in the framebuffer
         uint16_t * dest = buffer + dx;
         // the 16-bit color codes are copied byte by byte,
@@ -190,4 +398,18 @@ void Renderer::drawDigitOnSlice(uint8_t digit, uint8_t index, uint8_t sliceY, ui
             memcpy(dest + (py - sliceY) * ScreenWidth, source + (py - dy) * DigitSheetWidth, size);
         }
     }
-}
\ No newline at end of file
+}
+
+// renders a specific digit on its own block.
+// the image of a digit is opaque and drawn over everything else,
+// so that the block is nothing but a copy of it
+template <uint8_t Height, uint8_t Count>
+void SliceRenderer<Height, Count>::drawDigitOnBlock(uint8_t digit, uint16_t * buffer) {
+    const uint16_t * source = digitGlyph[digit];
+    for (uint8_t py = 0; py < DigitHeight; py++) {
+        memcpy(buffer + py * DigitWidth, source + py * DigitSheetWidth, DigitWidth << 1);
+    }
+}
+
+// the renderer of the game engine is compiled here once and for all
+template class SliceRenderer<RENDERER_SLICE_HEIGHT, RENDERER_BUFFERS>;
\ No newline at end of file
@@ -10,12 +10,18 @@
 // This version does not rely on the use of `gb.display`, but rather uses
 // the low-level `gb.tft` API to fully exploit the RGB565 color space.
 // 
-// The graphic rendering is cleverly calculated on two partial framebuffers,
-// which are alternately transmitted to the DMA controller, which acts as
-// an intermediary with the display device.
+// The graphic rendering is cleverly calculated on partial framebuffers,
+// which are transmitted in turn to the DMA controller, which acts as an
+// intermediary with the display device.
 // 
 // The screen surface is sliced to decompose the rendering calculation on
 // the framebuffers and save memory space.
+//
+// The height of the slices and the number of framebuffers are parameters
+// of the renderer: higher slices mean fewer transfers, and more buffers
+// leave the CPU free to compose ahead while the DMA controller is busy,
+// both at the cost of RAM. They are chosen at build time with the
+// `RENDERER_SLICE_HEIGHT` and `RENDERER_BUFFERS` definitions.
 // 
 // Many thanks to Andy (https://gamebuino.com/@aoneill) for the magical
 // routines related to the DMA controller.
@@ -27,6 +33,9 @@
 // loads descriptive data of sprites
 #include "sprites.h"
 
+// loads the frame-time profiler
+#include "../engine/Profiler.h"
+
 // loads the official library
 #include <Gamebuino-Meta.h>
 
@@ -34,44 +43,126 @@
 // to break an inclusion cycle
 class Game;
 
+// the configuration of the renderer used by the game engine
+// (the slice height is defined along with the sprites, which are indexed by slice)
+#ifndef RENDERER_BUFFERS
+    #define RENDERER_BUFFERS 2
+#endif
+
 // the class definition
-class Renderer
+template <uint8_t Height, uint8_t Count>
+class SliceRenderer
 {
+    public:
+
+        static constexpr uint8_t ScreenWidth     = 160;    // META screen width
+        static constexpr uint8_t ScreenHeight    = 128;    // META screen height
+        static constexpr uint8_t SliceHeight     = Height; // height of a screen slice
+        static constexpr uint8_t Buffers         = Count;  // number of framebuffers
+
+        static constexpr uint8_t DigitWidth      = 5; // width of each digit's sprite
+        static constexpr uint8_t DigitHeight     = 9; // height of each digit's sprite
+        static constexpr uint8_t DigitOffset     = 2; // offset in pixels between two digits
+        static constexpr uint8_t DigitSheetWidth = 10 * DigitWidth; // total width of the digits spritesheet
+        static constexpr uint8_t DigitX          = 149; // horizontal coordinate of the units digit
+        static constexpr uint8_t DigitY          = 6; // vertical coordinate of the counter
+        static constexpr uint8_t MaxDigits       = 5; // maximum number of digits of the counter
+
+        static constexpr uint8_t Slices = ScreenHeight / SliceHeight; // number of screen slices
+
+        static constexpr uint8_t MaxSprites      = 40; // maximum number of sprites in the display list
+        static constexpr uint8_t MaxSpriteHeight = SpriteMaxHeight; // maximum height of a sprite
+
     private:
 
-        // alternating framebuffers
-        uint16_t * buffer1;
-        uint16_t * buffer2;
+        static_assert(ScreenHeight % SliceHeight == 0, "the screen must be divided into slices of equal height");
+        static_assert(Slices <= 32, "too many slices to track their invalidation");
+        static_assert(Buffers >= 2, "at least two framebuffers are needed to compose while transferring");
+        static_assert(SliceHeight == SpriteSliceHeight, "the sprites must be indexed by the slices of the renderer");
+
+        // maximum number of slices a sprite can overlap
+        static constexpr uint8_t MaxSpan = SpriteMaxSpan;
 
-        // flag for an ongoing data transfer
+        // measures the time spent in the composition and the transfers
+        Profiler * profiler;
+
+        // framebuffers, used in turn and word-aligned for the DMA
+        // controller and for writing several pixels at once
+        alignas(4) uint16_t buffers[Buffers][ScreenWidth * SliceHeight];
+
+        // the framebuffers form a queue: the oldest one is being transferred
+        // (or is the next to be), the following ones are waiting for their
+        // turn, and the others are free to compose the next slices
+        uint8_t queueStart;       // index of the oldest framebuffer of the queue
+        uint8_t queueSize;        // number of framebuffers in the queue
+        uint8_t queueY[Buffers];  // top border of the slice held by each framebuffer
+
+        // flag for an ongoing data transfer (of the oldest framebuffer)
         bool drawPending;
 
+        // slices that must be redrawn at the next rendering (one bit per slice)
+        uint32_t dirtySlices;
+        // digits of the counter that must be redrawn on their own at the next
+        // rendering, unless their slices are redrawn (one bit per digit)
+        uint8_t  dirtyDigits;
+
+        // display list: the sprites to be drawn during the current rendering
+        // are sorted into buckets, one per slice, so that each slice only
+        // walks through the sprites that overlap it
+        const Sprite * sprites[MaxSprites];          // sprites of the display list
+        uint8_t        spriteCount;                  // number of sprites in the display list
+        uint8_t        bucketStart[Slices + 1];      // position of each bucket in the following array
+        uint8_t        buckets[MaxSprites * MaxSpan]; // indices of the sprites, sorted by slice
+
+        // sorts the sprites of the display list into the slice buckets
+        void sortSprites();
+
+        // renders the digits of the counter that have changed, each one on its own block
+        void drawDigits(Game * engine);
+
         // initiates memory forwarding to the DMA controller
         void customDrawBuffer(uint8_t x, uint8_t y, uint16_t * buffer, uint8_t w, uint8_t h);
         // waits for the memory transfer to be completed
         // and close the transaction with the DMA controller
         void waitForPreviousDraw();
+        // releases the framebuffer whose transfer is completed, and starts
+        // the transfer of the next one (waiting for it if requested)
+        void sendQueue(bool wait);
 
     public:
 
-        static constexpr uint8_t ScreenWidth     = 160; // META screen width
-        static constexpr uint8_t ScreenHeight    = 128; // META screen height
-        static constexpr uint8_t SliceHeight     = 8;   // height of a screen slice
+        SliceRenderer(Profiler * profiler); // constructor
 
-        static constexpr uint8_t DigitWidth      = 5; // width of each digit's sprite
-        static constexpr uint8_t DigitHeight     = 9; // height of each digit's sprite
-        static constexpr uint8_t DigitOffset     = 2; // offset in pixels between two digits
-        static constexpr uint8_t DigitSheetWidth = 10 * DigitWidth; // total width of the digits spritesheet
+        // marks the slices that will have to be redrawn
+        void invalidate(const Sprite & sprite);         // those overlapped by a sprite
+        void invalidateRows(uint8_t y, uint8_t height); // those overlapped by a horizontal band
+        void invalidateCounter();                       // those overlapped by the counter
+        void invalidateDigit(uint8_t index);            // or only the block of a digit of the counter
+        void invalidateAll();                           // all of them
+        // indicates whether anything will have to be redrawn
+        bool isDirty();
+
+        // switches the display device on or off (the image is kept meanwhile)
+        void switchDisplay(bool on);
 
-        Renderer();  // constructor
-        ~Renderer(); // destructor
+        // builds the display list of the next rendering
+        void clearSprites();                    // empties the display list
+        void addSprite(const Sprite & sprite);  // adds a sprite to the display list
 
         // starts the graphic rendering of the game scene
+        // (only the slices marked as invalid are redrawn)
         void draw(Game * engine);
+        // renders the sprites of the display list that overlap the current screen slice
+        void drawSpritesOnSlice(uint8_t sliceY, uint16_t * buffer);
         // renders a specific sprite on the current screen slice
-        void drawSpriteOnSlice(Sprite sprite, uint8_t sliceY, uint16_t * buffer);
+        void drawSpriteOnSlice(const Sprite & sprite, const SpriteBand & band, uint16_t * buffer);
         // renders a specific digit on the current screen slice
         void drawDigitOnSlice(uint8_t digit, uint8_t index, uint8_t sliceY, uint16_t * buffer);
+        // renders a specific digit on its own block (DigitWidth x DigitHeight)
+        void drawDigitOnBlock(uint8_t digit, uint16_t * buffer);
 };
 
+// the renderer of the game engine
+typedef SliceRenderer<RENDERER_SLICE_HEIGHT, RENDERER_BUFFERS> Renderer;
+
 #endif
\ No newline at end of file
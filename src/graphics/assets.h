@@ -7,6 +7,13 @@
 // -------------------------------------------------------------------------
 //                               Graphic Assets
 // -------------------------------------------------------------------------
+// This file is generated by the asset compiler (`tools/assets.cpp`) from
+// the images of the `assets` folder: do not edit it by hand.
+//
+// The backgrounds are stored as 8-bit indices in a common color lookup
+// table, which is expanded in RGB565 at rendering time. The boot scene
+// is stored as the runs of pixels that differ from the stage.
+// -------------------------------------------------------------------------
 
 #ifndef DONKEY_KONG_JR_ASSETS
 #define DONKEY_KONG_JR_ASSETS
@@ -14,397 +21,734 @@
 // loads the official library
 #include <Gamebuino-Meta.h>
 
-constexpr uint16_t STAGE_COLORMAP[] = {
-	// empty stage
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7de7, 0x5de7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x0000, 0x0000, 0x0000, 0xaaec, 0xaaec, 0x0000, 0x0000, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1cdf, 0x2c3d, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x0000, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x0000, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3cdf, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0x2c3d, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x0000, 0xaaec, 0xaaec, 0x0000, 0x0000, 0xaaec, 0x0000, 0x0000, 0xaaec, 0xaaec, 0x0000, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7de7, 0x3ce7, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x58c6, 0x38c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0x2c3d, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x0000, 0x83db, 0x0000, 0x3ce7, 0x1cdf, 0x0000, 0x1cdf, 0x3ce7, 0x0000, 0x83db, 0x0000, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x5ce7, 0x1bdf, 0x2c3d, 0x2c3d, 0x79ce, 0x59c6, 0x58c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x38c6, 0x2c3d, 0x58c6, 0x58c6, 0x58c6, 0x2c3d, 0x58c6, 0x58c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0x1bdf, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x0000, 0x0000, 0x83db, 0x0000, 0xfbde, 0x0000, 0xdbd6, 0x0000, 0xfbde, 0x0000, 0x83db, 0x0000, 0x0000, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0x2c3d, 0xbace, 0x99ce, 0x79c6, 0x59c6, 0x2c3d, 0x2c3d, 0x58c6, 0x58c6, 0x59c6, 0x59c6, 0x59c6, 0x79c6, 0x79c6, 0x79c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0x2c3d, 0x2c3d, 0xdbd6, 0x1bdf, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x0000, 0x7de7, 0x3ce7, 0x0000, 0x0000, 0xdbd6, 0xdad6, 0xbad6, 0xbad6, 0xdad6, 0x0000, 0x0000, 0x3ce7, 0x7de7, 0x0000, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7de7, 0x3ce7, 0xfbde, 0xdad6, 0x9ace, 0x99ce, 0x2c3d, 0x2c3d, 0x79c6, 0x79ce, 0x79ce, 0x79ce, 0x99ce, 0x99ce, 0x99ce, 0x9ace, 0x99ce, 0x99ce, 0x79ce, 0x59c6, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x2aaf, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x0000, 0x0000, 0x0000, 0x1cdf, 0x0000, 0xdad6, 0x0000, 0x0000, 0xbad6, 0x0000, 0x0000, 0xdad6, 0x0000, 0x1cdf, 0x0000, 0x0000, 0x0000, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xfbd6, 0xdad6, 0xbad6, 0xbace, 0x9ace, 0x9ace, 0x9ace, 0xbace, 0xbad6, 0xdad6, 0xdad6, 0xdbd6, 0xdad6, 0xdad6, 0xbad6, 0x9ace, 0x79ce, 0x79c6, 0x79c6, 0x247a, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x0000, 0xaaec, 0x0000, 0x3cdf, 0x0000, 0x0000, 0xdad6, 0x0000, 0xdad6, 0x0000, 0xdad6, 0x0000, 0xdad6, 0x0000, 0x0000, 0x3cdf, 0x0000, 0xaaec, 0x0000, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0x1cdf, 0xfbde, 0xfbde, 0xdbd6, 0xdbd6, 0xdad6, 0xdbd6, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1cdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdad6, 0xbace, 0x99ce, 0x79ce, 0x247a, 0x247a, 0x2aaf, 0x2aaf, 0x3cdf, 0x2c3d, 0x2c3d, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x0000, 0xaaec, 0xaaec, 0x83db, 0x0000, 0xfbde, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbde, 0xfbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbde, 0x0000, 0x83db, 0xaaec, 0xaaec, 0x0000, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x7de7, 0x5ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0x1bdf, 0x1bdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5ce7, 0x5de7, 0x5de7, 0x5ce7, 0x3ce7, 0x3cdf, 0xfbde, 0xdbd6, 0xbad6, 0x9ace, 0x9ace, 0x247a, 0x2aaf, 0xfbd6, 0xfbde, 0x1bdf, 0x3cdf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x0000, 0xaaec, 0x83db, 0x0000, 0xfbde, 0xfbd6, 0xfbd6, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xfbd6, 0xfbd6, 0xfbde, 0x0000, 0x83db, 0xaaec, 0x0000, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x5de7, 0x5de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7de7, 0x7def, 0x9def, 0x9def, 0x9def, 0x9def, 0x7def, 0x5de7, 0x3ce7, 0x1bdf, 0xfbd6, 0xdad6, 0xbad6, 0x2aaf, 0x2aaf, 0x247a, 0xfbd6, 0xfbde, 0x1bdf, 0x3ce7, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x0000, 0xaaec, 0x0000, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0x1bdf, 0x1cdf, 0x3cdf, 0x3ce7, 0x3cdf, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0x0000, 0xaaec, 0x0000, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x9def, 0x7def, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7de7, 0x5ce7, 0x1cdf, 0xfbde, 0xdbd6, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0xfbde, 0x1bdf, 0x3ce7, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x0000, 0xaaec, 0xaaec, 0x0000, 0xfbd6, 0xfbde, 0x1bdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x1cdf, 0x1bdf, 0xfbde, 0xfbd6, 0x0000, 0xaaec, 0xaaec, 0x0000, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5de7, 0x1cdf, 0xfbde, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0x1cdf, 0x5ce7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x0000, 0xaaec, 0xaaec, 0x0000, 0xfbd6, 0x1bdf, 0x3ce7, 0x5ce7, 0x5de7, 0x7de7, 0x7def, 0x7def, 0x7def, 0x7de7, 0x5de7, 0x5ce7, 0x3ce7, 0x1bdf, 0xfbd6, 0x0000, 0xaaec, 0xaaec, 0x0000, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7de7, 0x0000, 0x83db, 0xaaec, 0x0000, 0xfbde, 0x1cdf, 0x5ce7, 0x7de7, 0x9def, 0x9def, 0x0000, 0x0000, 0x0000, 0x9def, 0x9def, 0x7de7, 0x5ce7, 0x1cdf, 0xfbde, 0x0000, 0xaaec, 0x83db, 0x0000, 0x7de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3cdf, 0xfbde, 0xdbd6, 0xdbd6, 0xfbde, 0x247a, 0xa8c3, 0x7def, 0x9eef, 0x2aaf, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x0000, 0x83db, 0x83db, 0x0000, 0xfbde, 0x3ce7, 0x7de7, 0x9def, 0x9eef, 0x0000, 0xbeef, 0x9eef, 0xbeef, 0x0000, 0x9eef, 0x9def, 0x7de7, 0x3ce7, 0xfbde, 0x0000, 0x83db, 0x83db, 0x0000, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x3ce7, 0x1bdf, 0xdbd6, 0xdbd6, 0x2c3d, 0x247a, 0xa8c3, 0xaaec, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5ce7, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x5ce7, 0x9def, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x5ce7, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xbef7, 0xbeef, 0x9def, 0x2c3d, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0x2aaf, 0x2aaf, 0xbef7, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x0000, 0x0000, 0x0000, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0x0000, 0x0000, 0x0000, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x3ce7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0x0000, 0x83db, 0x83db, 0x0000, 0x1bdf, 0x5ce7, 0x7def, 0x9eef, 0x0000, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x0000, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0x0000, 0x83db, 0x83db, 0x0000, 0x3ce7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0x9eef, 0x7de7, 0x3ce7, 0x0000, 0x83db, 0x0000, 0xdad6, 0xfbde, 0x3ce7, 0x0000, 0x7def, 0x9def, 0x0000, 0x9def, 0x7def, 0x9def, 0x0000, 0x9def, 0x7def, 0x0000, 0x3ce7, 0xfbde, 0xdad6, 0x0000, 0x83db, 0x0000, 0x3ce7, 0x7de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xbef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0x9eef, 0x7de7, 0x3ce7, 0xfbd6, 0x0000, 0xbace, 0xdad6, 0xfbde, 0x3cdf, 0x5ce7, 0x0000, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0x0000, 0x5ce7, 0x3cdf, 0xfbde, 0xdad6, 0xbace, 0x0000, 0xfbd6, 0x3ce7, 0x7de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x7def, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0xfbde, 0x0000, 0xbad6, 0xdbd6, 0xfbde, 0x0000, 0x3ce7, 0x5de7, 0x0000, 0x0000, 0x7def, 0x7def, 0x7def, 0x7de7, 0x0000, 0x5de7, 0x3ce7, 0x0000, 0xfbde, 0xdbd6, 0xbad6, 0x0000, 0xfbde, 0x3ce7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0xaaec, 0xaaec, 0xbef7, 0xbeef, 0x2aaf, 0x2aaf, 0x5de7, 0x5ce7, 0x5de7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x7def, 0x5ce7, 0x1bdf, 0x0000, 0xdbd6, 0xfbd6, 0x1bdf, 0x3cdf, 0x0000, 0x0000, 0x0000, 0x5de7, 0x5de7, 0x7de7, 0x5de7, 0x5de7, 0x0000, 0x0000, 0x0000, 0x3cdf, 0x1bdf, 0xfbd6, 0xdbd6, 0x0000, 0x1bdf, 0x5ce7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0x3ce7, 0x5ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3cdf, 0x0000, 0xfbde, 0x1bdf, 0x0000, 0x3ce7, 0x3ce7, 0x3ce7, 0x0000, 0x0000, 0x0000, 0x5ce7, 0x0000, 0x0000, 0x0000, 0x3ce7, 0x3ce7, 0x3ce7, 0x0000, 0x1bdf, 0xfbde, 0x0000, 0x3cdf, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0xaaec, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x3ce7, 0x0000, 0x0000, 0x3ce7, 0x3ce7, 0x0000, 0x0000, 0x0000, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x0000, 0x0000, 0x0000, 0x3ce7, 0x3ce7, 0x0000, 0x0000, 0x3ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x1bdf, 0x247a, 0x247a, 0xaaec, 0x3ce7, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x0000, 0xaaec, 0x83db, 0x0000, 0x5ce7, 0x3ce7, 0x3ce7, 0x0000, 0x1cdf, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3cdf, 0x3cdf, 0x0000, 0x3ce7, 0x3ce7, 0x5ce7, 0x0000, 0x83db, 0xaaec, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xdbd6, 0xfbde, 0x1bdf, 0x247a, 0x247a, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0x5de7, 0xa8c3, 0xaaec, 0xbeef, 0xbef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x0000, 0xaaec, 0xaaec, 0x83db, 0x0000, 0x0000, 0x0000, 0x83db, 0x0000, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3cdf, 0x0000, 0x83db, 0x0000, 0x0000, 0x0000, 0x83db, 0xaaec, 0xaaec, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbad6, 0xdad6, 0xdbd6, 0xfbd6, 0xdbd6, 0x247a, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0x3ce7, 0x7de7, 0xa8c3, 0xaaec, 0xaaec, 0x247a, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xaaec, 0xaaec, 0xbef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x0000, 0xaaec, 0xaaec, 0xaaec, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0xaaec, 0xaaec, 0xaaec, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x7de7, 0x5ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x38c6, 0x2c3d, 0x2c3d, 0x38c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x38c6, 0x38c6, 0x2aaf, 0x58c6, 0x38c6, 0x2aaf, 0x2aaf, 0x59c6, 0x2aaf, 0x2aaf, 0xbace, 0xdad6, 0xdbd6, 0xdbd6, 0xdad6, 0xbad6, 0xbace, 0x2aaf, 0x247a, 0x247a, 0xaaec, 0x3ce7, 0x5de7, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0x2aaf, 0xbef7, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x3ce7, 0x0000, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x0000, 0x3ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x3ce7, 0x1cdf, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x38c6, 0x2c3d, 0x2c3d, 0x58c6, 0x2c3d, 0x2c3d, 0x58c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x58c6, 0x58c6, 0x58c6, 0x59c6, 0x2aaf, 0x59c6, 0x59c6, 0x2aaf, 0x59c6, 0x79c6, 0x2aaf, 0x9ace, 0xdad6, 0xdbd6, 0xfbd6, 0xdbd6, 0xdad6, 0x2c3d, 0x2c3d, 0x9ace, 0xbace, 0xdad6, 0x247a, 0x247a, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0x247a, 0x2aaf, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0x2c3d, 0x2c3d, 0x9eef, 0x9eef, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0xfbde, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfbde, 0x1cdf, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3cdf, 0xfbde, 0xdbd6, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0x59c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x58c6, 0x59c6, 0x59c6, 0x59c6, 0x59c6, 0x59c6, 0x59c6, 0x59c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x79c6, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x99ce, 0x9ace, 0xdad6, 0xfbd6, 0x1bdf, 0x1bdf, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x9ace, 0xbace, 0xbad6, 0xdbd6, 0xfbde, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x5de7, 0x5de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xaaec, 0xbef7, 0xbef7, 0xbef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7def, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5ce7, 0x1bdf, 0x0000, 0xbad6, 0xbace, 0xbace, 0xbace, 0xbace, 0xbad6, 0x0000, 0x83db, 0x0000, 0xfbde, 0x0000, 0x83db, 0x0000, 0xbad6, 0xbace, 0xbace, 0xbace, 0xbace, 0xbad6, 0x0000, 0x1bdf, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0xfbde, 0xdad6, 0xbace, 0x2c3d, 0x2c3d, 0x59c6, 0x59c6, 0x2c3d, 0x58c6, 0x58c6, 0x2c3d, 0x2c3d, 0x79c6, 0x79ce, 0x79ce, 0x99ce, 0x99ce, 0x99ce, 0x79ce, 0x79ce, 0x2c3d, 0x59c6, 0x2c3d, 0x2c3d, 0x79ce, 0x99ce, 0xbace, 0xbace, 0xbad6, 0xbace, 0xbace, 0xbace, 0xbace, 0xbad6, 0xdad6, 0xfbde, 0x1cdf, 0x3ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbad6, 0xbad6, 0xbad6, 0xdad6, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0x2aaf, 0x247a, 0xa8c3, 0xfbde, 0x1bdf, 0x1cdf, 0xa8c3, 0xa8c3, 0xaaec, 0x1cdf, 0x1cdf, 0x1cdf, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xaaec, 0xaaec, 0x2aaf, 0x2aaf, 0xbeef, 0xbef7, 0x2aaf, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x0000, 0xdbd6, 0xbad6, 0x9ace, 0x9ace, 0x9ace, 0x0000, 0x9ace, 0xbace, 0x0000, 0xdad6, 0xdbd6, 0xdad6, 0x0000, 0xbace, 0x9ace, 0x0000, 0x9ace, 0x9ace, 0x9ace, 0xbad6, 0xdbd6, 0x0000, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1cdf, 0xdbd6, 0xbad6, 0x2c3d, 0x79ce, 0x79ce, 0x79c6, 0x2c3d, 0x59c6, 0x79c6, 0x79ce, 0x79ce, 0x99ce, 0xbace, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbace, 0x9ace, 0x79ce, 0x79ce, 0x2c3d, 0x99ce, 0xbace, 0xdad6, 0xdbd6, 0xfbde, 0xfbde, 0xfbde, 0xfbd6, 0xfbd6, 0xfbd6, 0xfbde, 0x1bdf, 0x3cdf, 0x5ce7, 0x5de7, 0x5de7, 0x5ce7, 0x1cdf, 0xfbde, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9ace, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbace, 0xbace, 0xbace, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x1bdf, 0xdbd6, 0xbad6, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x9ace, 0xbace, 0xdad6, 0xdbd6, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbd6, 0xdad6, 0xbad6, 0x9ace, 0x9ace, 0xbad6, 0xdbd6, 0xfbde, 0x1cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x5de7, 0x7de7, 0x7def, 0x7def, 0x5de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x99ce, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xbad6, 0xbad6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7de7, 0x3ce7, 0x1bdf, 0xfbd6, 0xdbd6, 0xdad6, 0xbad6, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbad6, 0xdad6, 0xdbd6, 0xfbd6, 0x1bdf, 0x3ce7, 0x7de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x1bdf, 0xfbd6, 0xdbd6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdbd6, 0xfbd6, 0x1bdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3cdf, 0x1bdf, 0xfbd6, 0xdbd6, 0xdbd6, 0xfbd6, 0x1bdf, 0x3ce7, 0x5de7, 0x7de7, 0x7def, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7def, 0x9def, 0x9def, 0x9def, 0x7def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x79ce, 0xa8c3, 0xa8c3, 0xa8c3, 0x9ace, 0xbace, 0xbace, 0xbad6, 0xbace, 0x9ace, 0x9ace, 0x247a, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0x5ce7, 0x5de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x247a, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xaaec, 0xaaec, 0xaaec, 0x9eef, 0x7def, 0x2aaf, 0x2aaf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0xdbd6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdbd6, 0x2aaf, 0x2aaf, 0xfbde, 0x1bdf, 0x0000, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3cdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5de7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7de7, 0x5ce7, 0x3cdf, 0x1bdf, 0x1bdf, 0x1cdf, 0x3ce7, 0x7de7, 0x9def, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x5de7, 0x5de7, 0x5de7, 0x5de7, 0x5ce7, 0x3cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0x9ace, 0xbace, 0xbace, 0xbad6, 0xbad6, 0xbad6, 0xbace, 0x99ce, 0x79ce, 0x79ce, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0xa8c3, 0xa8c3, 0xa8c3, 0x83db, 0xaaec, 0x2aaf, 0xa8c3, 0xaaec, 0x1bdf, 0xaaec, 0xaaec, 0xaaec, 0xfbde, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xfbde, 0xaaec, 0xaaec, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0x0000, 0xaaec, 0xaaec, 0x0000, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x5de7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5de7, 0x7de7, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x5de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7def, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7def, 0x7def, 0x7de7, 0x5de7, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0x9ace, 0xbace, 0xbad6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xbad6, 0xbace, 0x99ce, 0x79ce, 0x2aaf, 0x79ce, 0x79ce, 0x247a, 0xa8c3, 0x2c3d, 0x2c3d, 0x247a, 0x2aaf, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x9eef, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x0000, 0x0000, 0x0000, 0x0000, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x9def, 0x7def, 0x7def, 0x7def, 0x9def, 0x9def, 0x9def, 0x9eef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x9def, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x7def, 0x5de7, 0x1cdf, 0xdbd6, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x247a, 0xbad6, 0xdad6, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0xbace, 0x9ace, 0x2aaf, 0x79ce, 0x79ce, 0x79ce, 0x247a, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0x9ace, 0x9ace, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0x7def, 0x5de7, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x3cdf, 0x3cdf, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x0000, 0xa8c3, 0xa8c3, 0x247a, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0xdad6, 0xfbde, 0x1cdf, 0x3ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3cdf, 0x1bdf, 0xdbd6, 0xdad6, 0x2aaf, 0x99ce, 0x79ce, 0x79ce, 0x79c6, 0x247a, 0x247a, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x79ce, 0xa8c3, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0x5de7, 0xaaec, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xfbde, 0xfbde, 0xfbde, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x1bdf, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xdbd6, 0xdbd6, 0xfbd6, 0xa8c3, 0x0000, 0xa8c3, 0x0000, 0xa8c3, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0xdbd6, 0x1cdf, 0x5ce7, 0x7de7, 0x7def, 0x7def, 0x7def, 0x5de7, 0x5ce7, 0x1cdf, 0xfbde, 0x2aaf, 0xbad6, 0xbace, 0x99ce, 0x79ce, 0x79c6, 0x59c6, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xbad6, 0xdad6, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xbace, 0xbace, 0xaaec, 0xaaec, 0xa8c3, 0x0000, 0xa8c3, 0x0000, 0xa8c3, 0xaaec, 0x5ce7, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7de7, 0x3cdf, 0xdbd6, 0x9ace, 0x79ce, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0xfbde, 0x3ce7, 0x7de7, 0x9def, 0x9eef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x5ce7, 0x2aaf, 0x1bdf, 0xfbde, 0xdbd6, 0xdad6, 0xbace, 0x99ce, 0x79ce, 0x2aaf, 0x58c6, 0x58c6, 0x59c6, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0x2c3d, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xaaec, 0xaaec, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0x247a, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x0000, 0x247a, 0x247a, 0x247a, 0x3ce7, 0x7de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7de7, 0x3ce7, 0xfbde, 0xbace, 0x79ce, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x1bdf, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x2aaf, 0x3ce7, 0x3cdf, 0x1cdf, 0xfbde, 0xdbd6, 0xbad6, 0x9ace, 0x79ce, 0x2aaf, 0x59c6, 0x2aaf, 0x2aaf, 0x79ce, 0x79ce, 0x79ce, 0x79c6, 0x247a, 0x247a, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0x247a, 0xbace, 0x9ace, 0x247a, 0x247a, 0x247a, 0x99ce, 0x2aaf, 0x2aaf, 0x9ace, 0x247a, 0x247a, 0x2aaf, 0x79ce, 0x247a, 0x247a, 0x79ce, 0x247a, 0xa8c3, 0xa8c3, 0x247a, 0x79ce, 0x79ce, 0x0000, 0x9ace, 0xbad6, 0xfbde, 0x3ce7, 0x7de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x5ce7, 0x1bdf, 0xdad6, 0x9ace, 0x79ce, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x5de7, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x2aaf, 0x5de7, 0x5de7, 0x5ce7, 0x3ce7, 0x1cdf, 0xfbde, 0xdad6, 0xbace, 0x99ce, 0x2aaf, 0x2aaf, 0x79ce, 0x99ce, 0x99ce, 0x99ce, 0x79ce, 0x59c6, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x2aaf, 0x2aaf, 0x9ace, 0x2aaf, 0x2aaf, 0x79ce, 0x99ce, 0x9ace, 0xbace, 0x9ace, 0x99ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x79ce, 0x2aaf, 0x2aaf, 0x79c6, 0x79c6, 0x79ce, 0x79ce, 0x99ce, 0x247a, 0x247a, 0x99ce, 0x79ce, 0x0000, 0x79ce, 0x0000, 0xbad6, 0xfbde, 0x3ce7, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x3ce7, 0xfbde, 0xbad6, 0x99ce, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x7de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x7de7, 0x7de7, 0x7def, 0x7de7, 0x5de7, 0x3ce7, 0x1bdf, 0xdbd6, 0xbad6, 0xbace, 0xbace, 0x9ace, 0x2aaf, 0x2aaf, 0x9ace, 0x99ce, 0x79ce, 0x59c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x1bdf, 0x2aaf, 0x2aaf, 0x2aaf, 0x79ce, 0x99ce, 0x9ace, 0xbad6, 0xbad6, 0xbace, 0x9ace, 0x99ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x2aaf, 0x79ce, 0x79ce, 0x79ce, 0x99ce, 0x9ace, 0x9ace, 0xbace, 0xbace, 0x9ace, 0x99ce, 0x0000, 0x99ce, 0x0000, 0xdbd6, 0x1bdf, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0xfbd6, 0xbad6, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x5de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x9def, 0x7def, 0x5de7, 0x3ce7, 0xaaec, 0xaaec, 0xaaec, 0xdad6, 0x2aaf, 0x2aaf, 0x247a, 0xaaec, 0xaaec, 0xaaec, 0x2c3d, 0x2c3d, 0x2aaf, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xfbde, 0xdad6, 0x9ace, 0x99ce, 0x99ce, 0xbace, 0xdad6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdad6, 0xbad6, 0xbace, 0xbace, 0x9ace, 0x9ace, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x9ace, 0xbace, 0xbad6, 0xbad6, 0xdad6, 0xdad6, 0xbad6, 0xbad6, 0xbad6, 0xbace, 0x0000, 0xdbd6, 0xfbde, 0x3ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0x9def, 0x7de7, 0x3ce7, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0x2c3d, 0x247a, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x1bdf, 0xdbd6, 0xbad6, 0xbace, 0xbad6, 0xdbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xfbd6, 0xdbd6, 0xdbd6, 0xdad6, 0xbad6, 0xbad6, 0xbad6, 0xdad6, 0xdbd6, 0xdbd6, 0xfbde, 0xfbde, 0xfbde, 0xfbd6, 0xfbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0x0000, 0xfbde, 0x1cdf, 0x5ce7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x2aaf, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0x9def, 0x7def, 0x5ce7, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xfbd6, 0xdbd6, 0xbad6, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x3ce7, 0xfbde, 0xdbd6, 0xdbd6, 0xfbde, 0x1bdf, 0x3ce7, 0x3ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0xfbde, 0xfbde, 0xfbd6, 0xfbd6, 0xfbde, 0x1bdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0x1cdf, 0x1bdf, 0x0000, 0x1bdf, 0x0000, 0x5ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbad6, 0xfbde, 0x3ce7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x2aaf, 0x3ce7, 0x3ce7, 0x2c3d, 0x7de7, 0x9def, 0x9def, 0x7def, 0x5ce7, 0x3cdf, 0x247a, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x38c6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x5de7, 0x3ce7, 0x1cdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x7de7, 0x7def, 0x7def, 0x9def, 0x7def, 0x7def, 0x7def, 0x7de7, 0x5de7, 0x3ce7, 0x3ce7, 0x3cdf, 0x3ce7, 0x3ce7, 0x5de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x5de7, 0x5de7, 0x5ce7, 0x3ce7, 0x0000, 0x3ce7, 0x0000, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x99ce, 0xbad6, 0xfbde, 0x5ce7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x2aaf, 0x1cdf, 0x1cdf, 0x3ce7, 0x5de7, 0x7def, 0x7def, 0x7de7, 0x5ce7, 0x1cdf, 0xfbde, 0x2aaf, 0xdad6, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0x58c6, 0xa8c3, 0x38c6, 0xa8c3, 0x38c6, 0x38c6, 0xa8c3, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 
-	0x7def, 0x7de7, 0x5de7, 0x5de7, 0x7de7, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x5de7, 0x7de7, 0x7def, 0x9def, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x5de7, 0x5ce7, 0x0000, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0xfbde, 0xbad6, 0x2c3d, 0x99ce, 0x9ace, 0xdbd6, 0x1bdf, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x2aaf, 0x1bdf, 0x1bdf, 0x1cdf, 0x5ce7, 0x7de7, 0x7def, 0x7de7, 0x2c3d, 0x2c3d, 0xdbd6, 0x2aaf, 0xbace, 0xbace, 0xbace, 0x2aaf, 0xbace, 0x9ace, 0x99ce, 0x2aaf, 0x59c6, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xaaec, 0xa8c3, 0xaaec, 0xaaec, 0x58c6, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0xa8c3, 
-	0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7de7, 0x5de7, 0x0000, 0x5de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0xfbde, 0xdad6, 0xbace, 0xbace, 0xdad6, 0xfbde, 0x3ce7, 0x7de7, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x5ce7, 0x7de7, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0xbad6, 0x2c3d, 0x2c3d, 0x9ace, 0x9ace, 0x2aaf, 0x9ace, 0x2aaf, 0x2aaf, 0x59c6, 0x59c6, 0x59c6, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x59c6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 
-	0xbef7, 0xbef7, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x0000, 0x5de7, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x5ce7, 0x1cdf, 0xdbd6, 0xdad6, 0xdbd6, 0xfbde, 0x3cdf, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x5ce7, 0x7de7, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0xbace, 0xbace, 0xbace, 0x2aaf, 0x2aaf, 0x99ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x79ce, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0x59c6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 
-	0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x0000, 0x5de7, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x1bdf, 0x3ce7, 0x5de7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x7de7, 0x2c3d, 0x3ce7, 0xfbde, 0x2aaf, 0xdad6, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0xdad6, 0xbad6, 0xbad6, 0xbace, 0x9ace, 0x9ace, 0x9ace, 0x99ce, 0x99ce, 0x2aaf, 0x79ce, 0x79ce, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x79c6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x7de7, 0x0000, 0x7de7, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x5ce7, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x5de7, 0x5de7, 0x3ce7, 0x1cdf, 0xfbde, 0x2aaf, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdad6, 0xbad6, 0xbace, 0x2aaf, 0x9ace, 0x99ce, 0x99ce, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x79ce, 0xa8c3, 0xa8c3, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x7de7, 0x0000, 0x7de7, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x9def, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x3ce7, 0x3cdf, 0x3ce7, 0x5ce7, 0x5de7, 0x5ce7, 0x3ce7, 0x1bdf, 0xfbde, 0x2aaf, 0xdbd6, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1cdf, 0x1cdf, 0x1cdf, 0x1cdf, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0x2aaf, 0xdad6, 0xbad6, 0xbace, 0x9ace, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xbace, 0xa8c3, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x0000, 0x5de7, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x5de7, 0x3ce7, 0x3cdf, 0x3ce7, 0x3ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x1cdf, 0xfbde, 0x2aaf, 0xfbde, 0xfbde, 0x1bdf, 0x3cdf, 0x3ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3cdf, 0x2aaf, 0xfbde, 0xdbd6, 0xdad6, 0xbace, 0x9ace, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xbad6, 0xfbd6, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xbeef, 0x9eef, 0x7def, 0x0000, 0x5de7, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x1cdf, 0x2aaf, 0x1bdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5de7, 0x7de7, 0x7def, 0x7def, 0x7def, 0x9def, 0x7def, 0x7de7, 0x5de7, 0x2aaf, 0x1cdf, 0x1bdf, 0xfbd6, 0xdad6, 0xbace, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xfbde, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x9eef, 0x7def, 0x5de7, 0x0000, 0x7de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x5de7, 0x5de7, 0x7de7, 0x7de7, 0x7de7, 0x5ce7, 0x3ce7, 0x2aaf, 0x3ce7, 0x3ce7, 0x5de7, 0x7de7, 0x9def, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7de7, 0x2aaf, 0x5ce7, 0x3ce7, 0x1cdf, 0xfbde, 0xdad6, 0xbace, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 
-	0xdef7, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbeef, 0x2c3d, 0x2c3d, 0x9def, 0x7def, 0x5de7, 0x5de7, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7def, 0x9def, 0x9def, 0x7def, 0x7de7, 0x5de7, 0x2aaf, 0x5de7, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x2aaf, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbd6, 0xbad6, 0x247a, 0xa8c3, 0xa8c3, 0xbace, 0xa8c3, 0xa8c3, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xaaec, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7def, 0x7de7, 0x5de7, 0x5de7, 0x0000, 0x0000, 0x0000, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7de7, 0x2aaf, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0xdad6, 0x9ace, 0x247a, 0xa8c3, 0xaaec, 0xdbd6, 0xa8c3, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xaaec, 0xaaec, 0xa8c3, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x5de7, 0x5de7, 0x5de7, 0x0000, 0x7de7, 0x9def, 0x0000, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2aaf, 0x7def, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x3ce7, 0x1bdf, 0xdbd6, 0xbad6, 0x247a, 0xa8c3, 0xa8c3, 0xdbd6, 0xa8c3, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xa8c3, 0xa8c3, 0x7de7, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x5de7, 0x0000, 0x7de7, 0x7def, 0x0000, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x2aaf, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x2aaf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1cdf, 0xfbde, 0xdad6, 0xbace, 0x247a, 0xa8c3, 0xdbd6, 0x1cdf, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x2aaf, 0xa8c3, 0x3ce7, 0x3cdf, 0x1bdf, 0x2aaf, 0x2aaf, 0x1cdf, 0x3ce7, 0x5de7, 0x5de7, 0x5de7, 0x5de7, 0x0000, 0x0000, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7def, 0x2aaf, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x2aaf, 0x1cdf, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x1bdf, 0xfbd6, 0xdad6, 0xbad6, 0x247a, 0xaaec, 0x1cdf, 
-	0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xfbde, 0x2aaf, 0xdbd6, 0xfbde, 0x2aaf, 0x3ce7, 0x5de7, 0x7de7, 0x5de7, 0x5de7, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x2aaf, 0x1cdf, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0x1bdf, 0xfbd6, 0xdbd6, 0x247a, 0xa8c3, 0xaaec, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0xa8c3, 0x247a, 0xfbde, 0xfbde, 0x2aaf, 0x2aaf, 0x2aaf, 0xdbd6, 0xfbd6, 0x2aaf, 0x5ce7, 0x7de7, 0x7def, 0x7de7, 0x5de7, 0x5ce7, 0x5de7, 0x7def, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x2aaf, 0x1cdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x3ce7, 0x1bdf, 0xfbde, 0x247a, 0xa8c3, 0xa8c3, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x3ce7, 0x1cdf, 0x247a, 0x247a, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0x2aaf, 0x2aaf, 0x2aaf, 0x1cdf, 0x2aaf, 0x7def, 0x7def, 0x7def, 0x7de7, 0x5de7, 0x7de7, 0x7def, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x2aaf, 0x3ce7, 0x3ce7, 0x5de7, 0x7de7, 0x7def, 0x7def, 0x5de7, 0x3ce7, 0x1bdf, 0xfbde, 0x247a, 0xa8c3, 
-	0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x247a, 0xfbde, 0x1bdf, 0x1bdf, 0x2aaf, 0x2aaf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0xdad6, 0xbad6, 0xdad6, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbd6, 0xfbde, 0x2aaf, 0x2aaf, 0x2aaf, 0x7def, 0x9def, 0x9def, 0x7def, 0x7def, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x2aaf, 0x5de7, 0x7def, 0x9def, 0x9eef, 0x9eef, 0x7def, 0x5ce7, 0x3cdf, 0x1bdf, 0x247a, 0xa8c3, 
-	0xdbd6, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbad6, 0xdad6, 0xdbd6, 0x2aaf, 0x2aaf, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdad6, 0xdad6, 0xdad6, 0xdbd6, 0xfbd6, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0x1bdf, 0x2aaf, 0x2aaf, 0x2aaf, 0x9def, 0x9eef, 0x9eef, 0x9def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x2aaf, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7de7, 0x2aaf, 0x7def, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x7de7, 0x3ce7, 0x1cdf, 0x1cdf, 0x247a, 
-	0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x79ce, 0x9ace, 0xbace, 0x2aaf, 0x2aaf, 0xbad6, 0xdad6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbde, 0xfbde, 0x1cdf, 0x1cdf, 0x1cdf, 0x1cdf, 0x1bdf, 0x1cdf, 0x3cdf, 0x2aaf, 0x2aaf, 0x2aaf, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x7def, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0x1cdf, 0x3ce7, 
-	0xfbde, 0xbace, 0x2c3d, 0x2c3d, 0x59c6, 0x2aaf, 0x2aaf, 0x9ace, 0x2aaf, 0x2aaf, 0xbad6, 0xdad6, 0xdbd6, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1cdf, 0x3ce7, 0x3ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0x1cdf, 0x3ce7, 0x2aaf, 0x2aaf, 0x2aaf, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 
-	0xfbde, 0xbad6, 0x2c3d, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x2aaf, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbde, 0x1cdf, 0x3ce7, 0x5ce7, 0x5ce7, 0x5de7, 0x7de7, 0x7def, 0x7def, 0x7def, 0x7de7, 0x5de7, 0x3ce7, 0x3cdf, 0x1cdf, 0x3cdf, 0x2aaf, 0x5de7, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xaaec, 0xaaec, 0xa8c3, 0x2aaf, 0x2aaf, 0xaaec, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x2aaf, 0x2aaf, 0x7de7, 0x7def, 0x2aaf, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x5de7, 
-	0x1cdf, 0xdbd6, 0xbace, 0x99ce, 0x99ce, 0x9ace, 0xbad6, 0xdbd6, 0xdbd6, 0xfbde, 0xfbde, 0x1cdf, 0x3ce7, 0x5ce7, 0x7de7, 0x7def, 0x9def, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0x9eef, 0x9eef, 0x7def, 0x5de7, 0x3ce7, 0x3cdf, 0x1cdf, 0x2aaf, 0x3ce7, 0x5de7, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x247a, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0x247a, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0x2aaf, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0x247a, 0x2aaf, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0x2aaf, 0x247a, 0xaaec, 0xaaec, 0x2aaf, 0x2aaf, 0x247a, 0xaaec, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x7def, 
-	0x3ce7, 0x1bdf, 0xdbd6, 0xdad6, 0xbad6, 0xdad6, 0xdbd6, 0xfbde, 0x1bdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x5de7, 0x3ce7, 0x3cdf, 0x1cdf, 0x2aaf, 0x2aaf, 0x5de7, 0x7de7, 0x9def, 0x2aaf, 0xbeef, 0xbeef, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0x2aaf, 0x2aaf, 0xbeef, 0x9eef, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0x2aaf, 0x2aaf, 0xbeef, 0xbeef, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xa8c3, 0x7def, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xaaec, 0xa8c3, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x7def, 0x2aaf, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 
-	0x7de7, 0x3ce7, 0x1bdf, 0xfbde, 0xfbde, 0xfbde, 0x1bdf, 0x1cdf, 0x3cdf, 0x3ce7, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x3ce7, 0x1cdf, 0x1cdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x2aaf, 0x7de7, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0x7de7, 0x7de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x5ce7, 0x5ce7, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0x247a, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 
-	0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x5ce7, 0x7de7, 0x7def, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5ce7, 0x3ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0x3cdf, 0x2aaf, 0x5ce7, 0x7de7, 0x7def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x2c3d, 0x2c3d, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x7de7, 0x2c3d, 0x2c3d, 0x9eef, 0x9eef, 0x9def, 0x7def, 0x5de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xfbde, 0xfbde, 0xfbde, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0x3cdf, 0x1cdf, 0x1bdf, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x1bdf, 0x1bdf, 0x2aaf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0x5ce7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x5de7, 0x2aaf, 0x7def, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 
-	0xbeef, 0x9def, 0x7def, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x3ce7, 0x5ce7, 0x2c3d, 0x2c3d, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x3ce7, 0x1cdf, 0x1bdf, 0x1bdf, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7def, 0x7de7, 0x5de7, 0x3ce7, 0x1bdf, 0xfbd6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0x2aaf, 0x247a, 0xdbd6, 0xfbd6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xfbd6, 0xdbd6, 0xdbd6, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xfbd6, 0xfbde, 0xfbd6, 0xdbd6, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x2aaf, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0xa8c3, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0x2aaf, 0x247a, 0xfbde, 0x3cdf, 0x5de7, 0x9def, 0xbeef, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x5ce7, 0x2aaf, 0x5ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x3cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0x1bdf, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x5de7, 0x5de7, 0x5ce7, 0x3cdf, 0xfbde, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x99ce, 0x79ce, 0x2aaf, 0x247a, 0x2aaf, 0x247a, 0xaaec, 0x1cdf, 0x5de7, 0x9def, 0x9eef, 0x9eef, 0x7def, 0x5de7, 0x3ce7, 0x3cdf, 0x2aaf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x5de7, 0x3ce7, 0x1bdf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x7def, 0x7def, 0x9def, 0x9def, 0x9def, 0x9def, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x1cdf, 0x1cdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x2c3d, 0x2c3d, 0x5ce7, 0x5de7, 0x5ce7, 0x3cdf, 0xfbde, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x99ce, 0x9ace, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0x9ace, 0x9ace, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x2aaf, 0xbace, 0xbace, 0x247a, 0x247a, 0x247a, 0x247a, 0x79c6, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x79ce, 0x79ce, 0x2aaf, 0x79c6, 0x79ce, 0x2aaf, 0x247a, 0x247a, 0x1bdf, 0x5de7, 0x9def, 0x9eef, 0x9def, 0x7de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x2aaf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0x1bdf, 0xfbde, 0xfbde, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x5ce7, 0x7de7, 0x7def, 0x9def, 0x9eef, 0xbeef, 0x9eef, 0x9def, 0x7de7, 0x2c3d, 0x3ce7, 0x1cdf, 0x1cdf, 0x1cdf, 0x3cdf, 0x3ce7, 0x3cdf, 0x1cdf, 0x1bdf, 0xfbde, 0x1bdf, 0x2c3d, 0x5ce7, 0x5de7, 0x5de7, 0x3ce7, 0xfbde, 0xdad6, 0x99ce, 0x79ce, 0x59c6, 0x58c6, 0x58c6, 0x59c6, 0x59c6, 0x2aaf, 0x2aaf, 0x99ce, 0x2aaf, 0x2aaf, 0x79ce, 0x2aaf, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x99ce, 0x9ace, 0xbace, 0xbace, 0x9ace, 0x99ce, 0x79ce, 0x79c6, 0x59c6, 0x2aaf, 0x79c6, 0x79ce, 0x2aaf, 0x99ce, 0x99ce, 0x2aaf, 0x79ce, 0x79c6, 0x59c6, 0x2aaf, 0x59c6, 0x79c6, 0x247a, 0x247a, 0xaaec, 0xaaec, 0xa8c3, 0x247a, 0x247a, 0x79ce, 0x79ce, 0x99ce, 0x2aaf, 0x2aaf, 0x9ace, 0x99ce, 0x2aaf, 0x79ce, 0x79c6, 0x79c6, 0x79c6, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0xbace, 0xdbd6, 0x1cdf, 0x5de7, 0x9def, 0x9eef, 0x9def, 0x7de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x2aaf, 0x3ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0xfbde, 0xfbd6, 0xdbd6, 0x2aaf, 0xfbde, 0x1bdf, 0x1cdf, 0x3ce7, 0x7de7, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x1cdf, 0x1cdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x1bdf, 0x1cdf, 0x5ce7, 0x7de7, 0x7de7, 0x5ce7, 0x1cdf, 0xdbd6, 0xbace, 0x99ce, 0x79ce, 0x79c6, 0x79c6, 0x79c6, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x2aaf, 0x99ce, 0x79ce, 0x2aaf, 0x79ce, 0x79ce, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x9ace, 0xbace, 0xbace, 0x9ace, 0x9ace, 0x79ce, 0x79ce, 0x79c6, 0x79c6, 0x2aaf, 0x2aaf, 0x99ce, 0x99ce, 0x99ce, 0x2aaf, 0x79ce, 0x79ce, 0x79c6, 0x59c6, 0x2aaf, 0x79c6, 0x79ce, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x99ce, 0x79ce, 0x99ce, 0x99ce, 0x9ace, 0x9ace, 0x2aaf, 0x2aaf, 0x2aaf, 0x99ce, 0x79ce, 0x79ce, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x9ace, 0x9ace, 0x9ace, 0x99ce, 0x99ce, 0x2aaf, 0xbad6, 0xfbde, 0x3ce7, 0x7de7, 0x9eef, 0xbeef, 0x9eef, 0x7def, 0x5ce7, 0x3ce7, 0x3cdf, 0x3ce7, 0x2aaf, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x3ce7, 0x1bdf, 0xfbde, 0xdbd6, 0x2aaf, 0xdbd6, 0xfbde, 0x1bdf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3cdf, 0x1cdf, 0x3ce7, 0x5de7, 0x7def, 0x9def, 0x7def, 0x7de7, 0x5ce7, 0x3cdf, 0x1cdf, 0x3ce7, 0x5de7, 0x7def, 0x7def, 0x7de7, 0x3ce7, 0x1bdf, 0xdbd6, 0xbad6, 0xbace, 0x9ace, 0x9ace, 0x99ce, 0x99ce, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0x2aaf, 0x9ace, 0x9ace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbace, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x9ace, 0x9ace, 0xbace, 0x2aaf, 0xbace, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x79ce, 0x2aaf, 0x2aaf, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0xbace, 0xbace, 0xbace, 0xbad6, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xbad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0x2aaf, 0xdad6, 0xdbd6, 0x1bdf, 0x5ce7, 0x7def, 0xbeef, 0xbeef, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x5ce7, 0x2aaf, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x3ce7, 0x1bdf, 0xfbd6, 0x2aaf, 0xdbd6, 0xfbde, 0x1bdf, 0x3ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x3ce7, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0x9eef, 0x9eef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x5ce7, 0x7de7, 0x9def, 0x9eef, 0x9def, 0x7de7, 0x3ce7, 0x1bdf, 0xfbde, 0xdbd6, 0xdbd6, 0xdbd6, 0xdad6, 0xdad6, 0xdad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0x2aaf, 0xbad6, 0xdad6, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbd6, 0xfbd6, 0xfbd6, 0xfbd6, 0xdbd6, 0xdbd6, 0xdad6, 0xbad6, 0xbad6, 0xbad6, 0xdad6, 0xdad6, 0x2aaf, 0xdad6, 0xdad6, 0xdad6, 0xbad6, 0xbad6, 0xbace, 0xbace, 0xbace, 0xbace, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xdad6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0x2aaf, 0xfbde, 0x1bdf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x7de7, 0x5de7, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5de7, 0x3ce7, 0x1bdf, 0x2aaf, 0xfbde, 0x1bdf, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7de7, 0x5de7, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x7de7, 0x7de7, 0x9def, 0x9eef, 0xbeef, 0x9eef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0xfbd6, 0xdbd6, 0xdbd6, 0x2aaf, 0xfbd6, 0xfbde, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x3cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0x2aaf, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x2aaf, 0x3cdf, 0x3ce7, 0x5de7, 0x7def, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x7de7, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5de7, 0x3ce7, 0x2aaf, 0x3cdf, 0x3ce7, 0x5ce7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x9def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x5de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x1cdf, 0x1bdf, 0x1bdf, 0x2aaf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x7de7, 0x5de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x3cdf, 0x2aaf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0x1bdf, 0x1cdf, 0x3cdf, 0x3ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x5de7, 0x7de7, 0x9def, 0x9def, 0x9def, 0x9def, 0x7def, 0x7def, 0x7de7, 0x7de7, 0x5de7, 0x2aaf, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5de7, 0x2aaf, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0x9def, 0x9def, 0x7def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x2aaf, 0x5ce7, 0x7de7, 0x7def, 0x9def, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x7de7, 0x5de7, 0x5ce7, 0x2aaf, 0x5de7, 0x7de7, 0x7de7, 0x7def, 0x7de7, 0x5de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x5ce7, 0x5de7, 0x7def, 0x7def, 0x9def, 0x7def, 0x7def, 0x7de7, 0x7de7, 0x7def, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x2aaf, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x7de7, 0x2aaf, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x5de7, 0x2aaf, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x7de7, 0x2aaf, 0x7def, 0x9def, 0x9eef, 0x9eef, 0x9def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9def, 0x7def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7def, 0x2aaf, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0x9eef, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x9def, 0x9def, 0x7de7, 0x3ce7, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x5ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x5de7, 0x5ce7, 0x5ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7de7, 0x5de7, 0x5ce7, 0x2c3d, 0xfbde, 0xdad6, 0x9ace, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x5de7, 0x3ce7, 0xfbde, 0xdad6, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x3ce7, 0xfbde, 0xdad6, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x2c3d, 0x3ce7, 0xfbde, 0xdad6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3cdf, 0xfbde, 0x2c3d, 0x99ce, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0x9ace, 0x79ce, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0xfbd6, 0xbad6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7def, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0x2c3d, 0x79ce, 0x79ce, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x3ce7, 0xfbde, 0xbad6, 0x9ace, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0xfbd6, 0xbad6, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0xdad6, 0x2c3d, 0x2c3d, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x3ce7, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x7de7, 0x9def, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x7def, 0x5ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xaaec, 0xaaec, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x2c3d, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x7de7, 0x5de7, 0x2c3d, 0x7def, 0x9eef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xaaec, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x2aaf, 0x2aaf, 0x2aaf, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x2aaf, 0x2aaf, 0x2aaf, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x247a, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0x2aaf, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x247a, 0x2aaf, 0xaaec, 0xbef7, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xbeef, 0x9eef, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7de7, 0x7de7, 0x7de7, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xbeef, 0xbeef, 0xbeef, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xbeef, 0xbeef, 0xbeef, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xbeef, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0x5ce7, 0x5de7, 0x7de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0x9def, 0x9def, 0x9def, 0x7def, 0x7def, 0x9def, 0xa8c3, 0xa8c3, 0xa8c3, 0x7de7, 0x5ce7, 0x1cdf, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0x7de7, 0x7def, 0x7def, 0x7def, 0x9def, 0xa8c3, 0xa8c3, 0xa8c3, 0x9def, 0x7def, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7def, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0x7de7, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0x9def, 0x9def, 0x9def, 0x9def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0x1cdf, 0x1bdf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xa8c3, 0x5ce7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x5ce7, 0x5ce7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x5ce7, 0x3ce7, 0x1cdf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x3ce7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x5ce7, 0x5ce7, 0x3ce7, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x5de7, 0x5ce7, 0x3ce7, 0x3cdf, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x3ce7, 0xa8c3, 0xa8c3, 0xaaec, 0x3ce7, 0x5ce7, 0x5ce7, 0xaaec, 0xa8c3, 0xa8c3, 0x3cdf, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xdbd6, 0xdad6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xfbde, 0xfbde, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0x1bdf, 0xfbde, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0xa8c3,
+constexpr uint16_t STAGE_PALETTE[] = {
+	0xdef7, 0x2c3d, 0x2aaf, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def,
+	0x7de7, 0x5de7, 0x3ce7, 0x5ce7, 0x0000, 0x1cdf, 0xbace, 0xaaec,
+	0x3cdf, 0xdbd6, 0xdad6, 0xfbde, 0x58c6, 0x38c6, 0x83db, 0x1bdf,
+	0x79ce, 0x59c6, 0x99ce, 0x79c6, 0x247a, 0xbad6, 0x9ace, 0xfbd6,
+	0xa8c3, 0x29d4, 0xb6b5, 0xab34, 0xd6b5, 0xf7b5, 0xf7bd, 0x17be,
+	0x38be, 0x23cb, 0x18be, 0x699e, 0x96ad, 0xd7b5, 0x47b3, 0xe469,
+};
+
+constexpr uint8_t STAGE_BITMAP[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x08, 0x09, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x06, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x0b, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x08, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0d, 0x01, 0x01, 0x0e, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x0a, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0c, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x0d, 0x01, 0x0e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x10, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x01, 0x0b, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0c, 0x0f, 0x0f, 0x0c, 0x0c, 0x0f, 0x0c, 0x0c, 0x0f, 0x0f, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x08, 0x0a, 0x13, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x15, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x01, 0x0b, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x0c, 0x16, 0x0c, 0x0a, 0x0d, 0x0c, 0x0d, 0x0a, 0x0c, 0x16, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x0b, 0x17, 0x01, 0x01, 0x18, 0x19, 0x14, 0x01, 0x01, 0x01, 0x15, 0x01, 0x14, 0x14, 0x14, 0x01, 0x14, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x17, 0x0b, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x0c, 0x0c, 0x16, 0x0c, 0x13, 0x0c, 0x11, 0x0c, 0x13, 0x0c, 0x16, 0x0c, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0d, 0x01, 0x0e, 0x1a, 0x1b, 0x19, 0x01, 0x01, 0x14, 0x14, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x01, 0x01, 0x11, 0x17, 0x09, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x0c, 0x08, 0x0a, 0x0c, 0x0c, 0x11, 0x12, 0x1d, 0x1d, 0x12, 0x0c, 0x0c, 0x0a, 0x08, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x08, 0x0a, 0x13, 0x12, 0x1e, 0x1a, 0x01, 0x01, 0x1b, 0x18, 0x18, 0x18, 0x1a, 0x1a, 0x1a, 0x1e, 0x1a, 0x1a, 0x18, 0x19, 0x01, 0x1c, 0x1c, 0x01, 0x02, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x12, 0x0c, 0x0c, 0x1d, 0x0c, 0x0c, 0x12, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x0b, 0x17, 0x1f, 0x12, 0x1d, 0x0e, 0x1e, 0x1e, 0x1e, 0x0e, 0x1d, 0x12, 0x12, 0x11, 0x12, 0x12, 0x1d, 0x1e, 0x18, 0x1b, 0x1b, 0x1c, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0c, 0x0f, 0x0c, 0x10, 0x0c, 0x0c, 0x12, 0x0c, 0x12, 0x0c, 0x12, 0x0c, 0x12, 0x0c, 0x0c, 0x10, 0x0c, 0x0f, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0a, 0x0d, 0x13, 0x13, 0x11, 0x11, 0x12, 0x11, 0x1f, 0x13, 0x17, 0x17, 0x0d, 0x17, 0x13, 0x1f, 0x12, 0x0e, 0x1a, 0x18, 0x1c, 0x1c, 0x02, 0x02, 0x10, 0x01, 0x01, 0x08, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0c, 0x0f, 0x0f, 0x16, 0x0c, 0x13, 0x11, 0x11, 0x11, 0x1f, 0x13, 0x1f, 0x11, 0x11, 0x11, 0x13, 0x0c, 0x16, 0x0f, 0x0f, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x08, 0x0b, 0x0a, 0x10, 0x0d, 0x17, 0x17, 0x0d, 0x0a, 0x0b, 0x0b, 0x09, 0x09, 0x0b, 0x0a, 0x10, 0x13, 0x11, 0x1d, 0x1e, 0x1e, 0x1c, 0x02, 0x1f, 0x13, 0x17, 0x10, 0x0a, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x0c, 0x0f, 0x16, 0x0c, 0x13, 0x1f, 0x1f, 0x1f, 0x13, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x1f, 0x1f, 0x13, 0x0c, 0x16, 0x0f, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0b, 0x0b, 0x09, 0x08, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x09, 0x0a, 0x17, 0x1f, 0x12, 0x1d, 0x02, 0x02, 0x1c, 0x1f, 0x13, 0x17, 0x0a, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x0c, 0x0f, 0x0c, 0x13, 0x13, 0x13, 0x13, 0x17, 0x0d, 0x10, 0x0a, 0x10, 0x0d, 0x17, 0x13, 0x13, 0x13, 0x13, 0x0c, 0x0f, 0x0c, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x08, 0x0b, 0x0d, 0x13, 0x11, 0x02, 0x1c, 0x20, 0x0f, 0x13, 0x17, 0x0a, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x03, 0x03, 0x05, 0x0c, 0x0f, 0x0f, 0x0c, 0x1f, 0x13, 0x17, 0x0d, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0d, 0x17, 0x13, 0x1f, 0x0c, 0x0f, 0x0f, 0x0c, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0d, 0x13, 0x02, 0x02, 0x1c, 0x20, 0x0f, 0x0d, 0x0b, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x03, 0x04, 0x06, 0x0c, 0x0f, 0x0f, 0x0c, 0x1f, 0x17, 0x0a, 0x0b, 0x09, 0x08, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0b, 0x0a, 0x17, 0x1f, 0x0c, 0x0f, 0x0f, 0x0c, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x17, 0x11, 0x02, 0x02, 0x1c, 0x20, 0x0f, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x03, 0x05, 0x08, 0x0c, 0x16, 0x0f, 0x0c, 0x13, 0x0d, 0x0b, 0x08, 0x06, 0x06, 0x0c, 0x0c, 0x0c, 0x06, 0x06, 0x08, 0x0b, 0x0d, 0x13, 0x0c, 0x0f, 0x16, 0x0c, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x10, 0x13, 0x11, 0x11, 0x13, 0x1c, 0x20, 0x07, 0x05, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x04, 0x06, 0x09, 0x0c, 0x16, 0x16, 0x0c, 0x13, 0x0a, 0x08, 0x06, 0x05, 0x0c, 0x04, 0x05, 0x04, 0x0c, 0x05, 0x06, 0x08, 0x0a, 0x13, 0x0c, 0x16, 0x16, 0x0c, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x0a, 0x17, 0x11, 0x11, 0x01, 0x1c, 0x20, 0x0f, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x04, 0x06, 0x0b, 0x0c, 0x16, 0x16, 0x16, 0x0c, 0x0b, 0x06, 0x05, 0x04, 0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x05, 0x06, 0x0b, 0x0c, 0x16, 0x16, 0x16, 0x0c, 0x0b, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x06, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x1c, 0x1c, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x04, 0x07, 0x0a, 0x0c, 0x16, 0x16, 0x16, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x0c, 0x0c, 0x0c, 0x0c, 0x16, 0x16, 0x16, 0x0c, 0x0a, 0x07, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x04, 0x07, 0x0a, 0x0c, 0x16, 0x16, 0x0c, 0x17, 0x0b, 0x07, 0x05, 0x0c, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0c, 0x05, 0x07, 0x0b, 0x17, 0x0c, 0x16, 0x16, 0x0c, 0x0a, 0x07, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x05, 0x08, 0x0a, 0x0c, 0x16, 0x0c, 0x12, 0x13, 0x0a, 0x0c, 0x07, 0x06, 0x0c, 0x06, 0x07, 0x06, 0x0c, 0x06, 0x07, 0x0c, 0x0a, 0x13, 0x12, 0x0c, 0x16, 0x0c, 0x0a, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x04, 0x01, 0x01, 0x01, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x05, 0x08, 0x0a, 0x1f, 0x0c, 0x0e, 0x12, 0x13, 0x10, 0x0b, 0x0c, 0x07, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x07, 0x0c, 0x0b, 0x10, 0x13, 0x12, 0x0e, 0x0c, 0x1f, 0x0a, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x03, 0x03, 0x00, 0x03, 0x04, 0x05, 0x01, 0x01, 0x07, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x04, 0x07, 0x0a, 0x13, 0x0c, 0x1d, 0x11, 0x13, 0x0c, 0x0a, 0x09, 0x0c, 0x0c, 0x07, 0x07, 0x07, 0x08, 0x0c, 0x09, 0x0a, 0x0c, 0x13, 0x11, 0x1d, 0x0c, 0x13, 0x0a, 0x07, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x0f, 0x0f, 0x03, 0x04, 0x02, 0x02, 0x09, 0x0b, 0x09, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x04, 0x07, 0x0b, 0x17, 0x0c, 0x11, 0x1f, 0x17, 0x10, 0x0c, 0x0c, 0x0c, 0x09, 0x09, 0x08, 0x09, 0x09, 0x0c, 0x0c, 0x0c, 0x10, 0x17, 0x1f, 0x11, 0x0c, 0x17, 0x0b, 0x07, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x1c, 0x02, 0x02, 0x0a, 0x0b, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x04, 0x06, 0x09, 0x10, 0x0c, 0x13, 0x17, 0x0c, 0x0a, 0x0a, 0x0a, 0x0c, 0x0c, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0a, 0x0a, 0x0a, 0x0c, 0x17, 0x13, 0x0c, 0x10, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x1c, 0x20, 0x07, 0x07, 0x20, 0x0f, 0x1c, 0x02, 0x0f, 0x0f, 0x0f, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x04, 0x05, 0x08, 0x0a, 0x0c, 0x0c, 0x0a, 0x0a, 0x0c, 0x0c, 0x0c, 0x0d, 0x10, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0c, 0x0c, 0x0c, 0x0a, 0x0a, 0x0c, 0x0c, 0x0a, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x17, 0x1c, 0x1c, 0x0f, 0x0a, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x0f, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x03, 0x05, 0x07, 0x0c, 0x0f, 0x16, 0x0c, 0x0b, 0x0a, 0x0a, 0x0c, 0x0d, 0x0d, 0x10, 0x0a, 0x0a, 0x10, 0x10, 0x0c, 0x0a, 0x0a, 0x0b, 0x0c, 0x16, 0x0f, 0x0c, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x13, 0x17, 0x1c, 0x1c, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x09, 0x20, 0x0f, 0x04, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x03, 0x05, 0x07, 0x0c, 0x0f, 0x0f, 0x16, 0x0c, 0x0c, 0x0c, 0x16, 0x0c, 0x0d, 0x10, 0x0a, 0x0a, 0x10, 0x0c, 0x16, 0x0c, 0x0c, 0x0c, 0x16, 0x0f, 0x0f, 0x0c, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1d, 0x12, 0x11, 0x1f, 0x11, 0x1c, 0x1c, 0x02, 0x20, 0x20, 0x0a, 0x08, 0x20, 0x0f, 0x0f, 0x1c, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x0f, 0x0f, 0x03, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 
+	0x00, 0x00, 0x03, 0x05, 0x07, 0x0c, 0x0f, 0x0f, 0x0f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0f, 0x0f, 0x0f, 0x0c, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x08, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x01, 0x01, 0x15, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x15, 0x15, 0x02, 0x14, 0x15, 0x02, 0x02, 0x19, 0x02, 0x02, 0x0e, 0x12, 0x11, 0x11, 0x12, 0x1d, 0x0e, 0x02, 0x1c, 0x1c, 0x0f, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x02, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 
+	0x00, 0x03, 0x04, 0x05, 0x08, 0x0a, 0x0c, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0c, 0x0a, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0a, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x14, 0x14, 0x19, 0x02, 0x19, 0x19, 0x02, 0x19, 0x1b, 0x02, 0x1e, 0x12, 0x11, 0x1f, 0x11, 0x12, 0x01, 0x01, 0x1e, 0x0e, 0x12, 0x1c, 0x1c, 0x0f, 0x20, 0x20, 0x1c, 0x02, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x1c, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 
+	0x00, 0x03, 0x04, 0x06, 0x09, 0x0d, 0x13, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x16, 0x16, 0x16, 0x0c, 0x16, 0x16, 0x16, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x13, 0x0d, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x10, 0x13, 0x11, 0x0e, 0x01, 0x01, 0x01, 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1a, 0x1e, 0x12, 0x1f, 0x17, 0x17, 0x13, 0x01, 0x01, 0x01, 0x1e, 0x0e, 0x1d, 0x11, 0x13, 0x1c, 0x1c, 0x1c, 0x02, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x0f, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 
+	0x00, 0x03, 0x04, 0x06, 0x0b, 0x17, 0x0c, 0x1d, 0x0e, 0x0e, 0x0e, 0x0e, 0x1d, 0x0c, 0x16, 0x0c, 0x13, 0x0c, 0x16, 0x0c, 0x1d, 0x0e, 0x0e, 0x0e, 0x0e, 0x1d, 0x0c, 0x17, 0x0b, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0a, 0x13, 0x12, 0x0e, 0x01, 0x01, 0x19, 0x19, 0x01, 0x14, 0x14, 0x01, 0x01, 0x1b, 0x18, 0x18, 0x1a, 0x1a, 0x1a, 0x18, 0x18, 0x01, 0x19, 0x01, 0x01, 0x18, 0x1a, 0x0e, 0x0e, 0x1d, 0x0e, 0x0e, 0x0e, 0x0e, 0x1d, 0x12, 0x13, 0x0d, 0x0a, 0x0a, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x12, 0x11, 0x01, 0x01, 0x01, 0x1c, 0x02, 0x1c, 0x20, 0x13, 0x17, 0x0d, 0x20, 0x20, 0x0f, 0x0d, 0x0d, 0x0d, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x0f, 0x0f, 0x02, 0x02, 0x04, 0x03, 0x02, 0x03, 0x03, 0x00, 0x03, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+	0x00, 0x03, 0x04, 0x06, 0x09, 0x0c, 0x11, 0x1d, 0x1e, 0x1e, 0x1e, 0x0c, 0x1e, 0x0e, 0x0c, 0x12, 0x11, 0x12, 0x0c, 0x0e, 0x1e, 0x0c, 0x1e, 0x1e, 0x1e, 0x1d, 0x11, 0x0c, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x0d, 0x11, 0x1d, 0x01, 0x18, 0x18, 0x1b, 0x01, 0x19, 0x1b, 0x18, 0x18, 0x1a, 0x0e, 0x1d, 0x1d, 0x1d, 0x1d, 0x0e, 0x1e, 0x18, 0x18, 0x01, 0x1a, 0x0e, 0x12, 0x11, 0x13, 0x13, 0x13, 0x1f, 0x1f, 0x1f, 0x13, 0x17, 0x10, 0x0b, 0x09, 0x09, 0x0b, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x20, 0x20, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x1c, 0x02, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
+	0x00, 0x03, 0x04, 0x06, 0x09, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0e, 0x0e, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x17, 0x11, 0x1d, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x0e, 0x12, 0x11, 0x13, 0x13, 0x13, 0x13, 0x1f, 0x12, 0x1d, 0x1e, 0x1e, 0x1d, 0x11, 0x13, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x09, 0x08, 0x07, 0x07, 0x09, 0x0a, 0x0d, 0x17, 0x17, 0x17, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x1a, 0x20, 0x20, 0x20, 0x20, 0x1d, 0x1d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x03, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 
+	0x00, 0x03, 0x03, 0x05, 0x08, 0x0a, 0x17, 0x1f, 0x11, 0x12, 0x1d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x1d, 0x12, 0x11, 0x1f, 0x17, 0x0a, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x17, 0x1f, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x1f, 0x17, 0x0d, 0x0a, 0x0b, 0x0b, 0x0a, 0x10, 0x17, 0x1f, 0x11, 0x11, 0x1f, 0x17, 0x0a, 0x09, 0x08, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x06, 0x06, 0x06, 0x07, 0x08, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x18, 0x20, 0x20, 0x20, 0x1e, 0x0e, 0x0e, 0x1d, 0x0e, 0x1e, 0x1e, 0x1c, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x01, 0x01, 0x1c, 0x1c, 0x02, 0x1c, 0x01, 0x01, 0x20, 0x20, 0x0b, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x1c, 0x1c, 0x1c, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
+	0x0f, 0x0f, 0x0f, 0x05, 0x07, 0x02, 0x02, 0x17, 0x13, 0x1f, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x02, 0x02, 0x13, 0x17, 0x0c, 0x0c, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x10, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0d, 0x0a, 0x0b, 0x09, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0b, 0x10, 0x17, 0x17, 0x0d, 0x0a, 0x08, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x05, 0x06, 0x07, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x10, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x1c, 0x20, 0x20, 0x1e, 0x0e, 0x0e, 0x1d, 0x1d, 0x1d, 0x0e, 0x1a, 0x18, 0x18, 0x02, 0x1c, 0x1c, 0x20, 0x01, 0x01, 0x01, 0x1c, 0x02, 0x01, 0x01, 0x01, 0x20, 0x20, 0x0f, 0x0f, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x20, 0x1c, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
+	0x20, 0x20, 0x20, 0x16, 0x0f, 0x02, 0x20, 0x0f, 0x17, 0x0f, 0x0f, 0x0f, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x13, 0x0f, 0x0f, 0x02, 0x1c, 0x20, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0b, 0x0b, 0x09, 0x07, 0x06, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x09, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1c, 0x20, 0x1e, 0x0e, 0x1d, 0x11, 0x11, 0x11, 0x11, 0x1d, 0x0e, 0x1a, 0x18, 0x02, 0x18, 0x18, 0x1c, 0x20, 0x01, 0x01, 0x1c, 0x02, 0x01, 0x01, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
+	0x05, 0x20, 0x20, 0x20, 0x02, 0x02, 0x1c, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x0c, 0x0c, 0x0c, 0x0c, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x06, 0x05, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x09, 0x0d, 0x11, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x1c, 0x1d, 0x12, 0x1f, 0x13, 0x17, 0x17, 0x13, 0x1f, 0x11, 0x0e, 0x1e, 0x02, 0x18, 0x18, 0x18, 0x1c, 0x20, 0x20, 0x02, 0x02, 0x1c, 0x1c, 0x20, 0x1e, 0x1e, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 
+	0x07, 0x09, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0c, 0x20, 0x20, 0x1c, 0x05, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x09, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x12, 0x13, 0x0d, 0x0a, 0x0b, 0x0b, 0x0a, 0x10, 0x17, 0x11, 0x12, 0x02, 0x1a, 0x18, 0x18, 0x1b, 0x1c, 0x1c, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x18, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 
+	0x09, 0x0f, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x13, 0x13, 0x13, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x17, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x11, 0x11, 0x1f, 0x20, 0x0c, 0x20, 0x0c, 0x20, 0x09, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x06, 0x09, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x11, 0x0d, 0x0b, 0x08, 0x07, 0x07, 0x07, 0x09, 0x0b, 0x0d, 0x13, 0x02, 0x1d, 0x0e, 0x1a, 0x18, 0x1b, 0x19, 0x02, 0x1c, 0x1c, 0x1c, 0x1c, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 
+	0x0f, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x1d, 0x12, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x0e, 0x0e, 0x0f, 0x0f, 0x20, 0x0c, 0x20, 0x0c, 0x20, 0x0f, 0x0b, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x08, 0x10, 0x11, 0x1e, 0x18, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x13, 0x0a, 0x08, 0x06, 0x05, 0x04, 0x05, 0x06, 0x07, 0x0b, 0x02, 0x17, 0x13, 0x11, 0x12, 0x0e, 0x1a, 0x18, 0x02, 0x14, 0x14, 0x19, 0x02, 0x1c, 0x1c, 0x1c, 0x1c, 0x20, 0x01, 0x1c, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 
+	0x20, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x0f, 0x0f, 0x1c, 0x1c, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x1c, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x1c, 0x0f, 0x0f, 0x20, 0x20, 0x1c, 0x1c, 0x0c, 0x1c, 0x1c, 0x1c, 0x0a, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x08, 0x0a, 0x13, 0x0e, 0x18, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x17, 0x09, 0x06, 0x04, 0x03, 0x03, 0x03, 0x04, 0x05, 0x07, 0x02, 0x0a, 0x10, 0x0d, 0x13, 0x11, 0x1d, 0x1e, 0x18, 0x02, 0x19, 0x02, 0x02, 0x18, 0x18, 0x18, 0x1b, 0x1c, 0x1c, 0x20, 0x1c, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 
+	0x1c, 0x1c, 0x1c, 0x1c, 0x02, 0x1c, 0x1c, 0x1c, 0x0e, 0x1e, 0x1c, 0x1c, 0x1c, 0x1a, 0x02, 0x02, 0x1e, 0x1c, 0x1c, 0x02, 0x18, 0x1c, 0x1c, 0x18, 0x1c, 0x20, 0x20, 0x1c, 0x18, 0x18, 0x0c, 0x1e, 0x1d, 0x13, 0x0a, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x0b, 0x17, 0x12, 0x1e, 0x18, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x09, 0x05, 0x03, 0x03, 0x00, 0x03, 0x03, 0x05, 0x06, 0x02, 0x09, 0x09, 0x0b, 0x0a, 0x0d, 0x13, 0x12, 0x0e, 0x1a, 0x02, 0x02, 0x18, 0x1a, 0x1a, 0x1a, 0x18, 0x19, 0x1c, 0x1c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
+	0x02, 0x02, 0x1e, 0x02, 0x02, 0x18, 0x1a, 0x1e, 0x0e, 0x1e, 0x1a, 0x18, 0x18, 0x18, 0x18, 0x02, 0x02, 0x18, 0x02, 0x02, 0x1b, 0x1b, 0x18, 0x18, 0x1a, 0x1c, 0x1c, 0x1a, 0x18, 0x0c, 0x18, 0x0c, 0x1d, 0x13, 0x0a, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0a, 0x13, 0x1d, 0x1a, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x02, 0x08, 0x08, 0x07, 0x08, 0x09, 0x0a, 0x17, 0x11, 0x1d, 0x0e, 0x0e, 0x1e, 0x02, 0x02, 0x1e, 0x1a, 0x18, 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
+	0x17, 0x02, 0x02, 0x02, 0x18, 0x1a, 0x1e, 0x1d, 0x1d, 0x0e, 0x1e, 0x1a, 0x18, 0x18, 0x18, 0x18, 0x02, 0x02, 0x02, 0x18, 0x18, 0x18, 0x1a, 0x1e, 0x1e, 0x0e, 0x0e, 0x1e, 0x1a, 0x0c, 0x1a, 0x0c, 0x11, 0x17, 0x0b, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0d, 0x1f, 0x1d, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x09, 0x05, 0x03, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x02, 0x01, 0x01, 0x01, 0x06, 0x07, 0x09, 0x0a, 0x0f, 0x0f, 0x0f, 0x12, 0x02, 0x02, 0x1c, 0x0f, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x1c, 0x1c, 0x01, 0x01, 0x1c, 0x1c, 0x01, 0x01, 0x1c, 0x1c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+	0x13, 0x12, 0x1e, 0x1a, 0x1a, 0x0e, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1d, 0x0e, 0x0e, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1e, 0x0e, 0x1d, 0x1d, 0x12, 0x12, 0x1d, 0x1d, 0x1d, 0x0e, 0x0c, 0x11, 0x13, 0x0a, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x0b, 0x06, 0x04, 0x03, 0x00, 0x03, 0x04, 0x05, 0x07, 0x02, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x08, 0x0a, 0x20, 0x20, 0x02, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x02, 0x1c, 0x1c, 0x01, 0x1c, 0x20, 0x1c, 0x01, 0x01, 0x1c, 0x1c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+	0x17, 0x11, 0x1d, 0x0e, 0x1d, 0x11, 0x13, 0x17, 0x17, 0x17, 0x13, 0x13, 0x1f, 0x11, 0x11, 0x12, 0x1d, 0x1d, 0x1d, 0x12, 0x11, 0x11, 0x13, 0x13, 0x13, 0x1f, 0x1f, 0x11, 0x11, 0x11, 0x0c, 0x13, 0x0d, 0x0b, 0x07, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x13, 0x0b, 0x06, 0x04, 0x03, 0x00, 0x03, 0x04, 0x06, 0x08, 0x02, 0x09, 0x01, 0x01, 0x01, 0x05, 0x06, 0x07, 0x0b, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x1f, 0x11, 0x1d, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x1c, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x01, 0x01, 0x01, 
+	0x0a, 0x13, 0x11, 0x11, 0x13, 0x17, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x10, 0x0d, 0x13, 0x13, 0x1f, 0x1f, 0x13, 0x17, 0x10, 0x0a, 0x0a, 0x0a, 0x10, 0x0d, 0x0d, 0x17, 0x0c, 0x17, 0x0c, 0x0b, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x13, 0x0a, 0x07, 0x04, 0x03, 0x00, 0x03, 0x04, 0x06, 0x08, 0x02, 0x0a, 0x0a, 0x01, 0x08, 0x06, 0x06, 0x07, 0x0b, 0x10, 0x1c, 0x02, 0x1c, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x15, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x01, 0x01, 0x01, 
+	0x09, 0x0a, 0x0d, 0x0d, 0x0a, 0x0b, 0x08, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0a, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x0b, 0x0a, 0x0c, 0x0a, 0x0c, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x0a, 0x13, 0x01, 0x01, 0x01, 0x1a, 0x1d, 0x13, 0x0b, 0x07, 0x04, 0x03, 0x00, 0x03, 0x04, 0x06, 0x09, 0x02, 0x0d, 0x0d, 0x0a, 0x09, 0x07, 0x07, 0x08, 0x0b, 0x0d, 0x13, 0x02, 0x12, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x0f, 0x14, 0x20, 0x15, 0x20, 0x15, 0x15, 0x20, 0x20, 0x1c, 0x01, 0x01, 0x1c, 
+	0x07, 0x08, 0x09, 0x09, 0x08, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x08, 0x07, 0x06, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0b, 0x0c, 0x09, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x0a, 0x13, 0x1d, 0x01, 0x1a, 0x1e, 0x11, 0x17, 0x09, 0x06, 0x04, 0x03, 0x00, 0x03, 0x04, 0x06, 0x09, 0x02, 0x17, 0x17, 0x0d, 0x0b, 0x08, 0x07, 0x08, 0x01, 0x01, 0x11, 0x02, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x1e, 0x1a, 0x02, 0x19, 0x1c, 0x1c, 0x20, 0x20, 0x0f, 0x20, 0x0f, 0x20, 0x0f, 0x0f, 0x14, 0x20, 0x20, 0x1c, 0x1c, 0x20, 
+	0x05, 0x05, 0x06, 0x05, 0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0c, 0x09, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x0a, 0x13, 0x12, 0x0e, 0x0e, 0x12, 0x13, 0x0a, 0x08, 0x05, 0x03, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x02, 0x02, 0x01, 0x01, 0x0b, 0x08, 0x07, 0x01, 0x01, 0x01, 0x02, 0x1d, 0x01, 0x01, 0x1e, 0x1e, 0x02, 0x1e, 0x02, 0x02, 0x19, 0x19, 0x19, 0x1c, 0x1c, 0x1c, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x19, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x04, 0x05, 0x07, 0x0c, 0x09, 0x0c, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x0b, 0x0d, 0x11, 0x12, 0x11, 0x13, 0x10, 0x09, 0x06, 0x04, 0x03, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0a, 0x01, 0x01, 0x01, 0x0b, 0x08, 0x08, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x0e, 0x0e, 0x0e, 0x02, 0x02, 0x1a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x02, 0x18, 0x1c, 0x20, 0x20, 0x20, 0x0f, 0x19, 0x20, 0x20, 0x20, 0x20, 
+	0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0c, 0x09, 0x0c, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0a, 0x0d, 0x17, 0x17, 0x0a, 0x09, 0x07, 0x04, 0x03, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0a, 0x01, 0x01, 0x01, 0x08, 0x08, 0x01, 0x0a, 0x13, 0x02, 0x12, 0x01, 0x01, 0x01, 0x12, 0x12, 0x1d, 0x1d, 0x0e, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x02, 0x18, 0x18, 0x1c, 0x20, 0x20, 0x20, 0x1b, 0x20, 0x20, 0x20, 0x20, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x08, 0x0c, 0x08, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0b, 0x0b, 0x08, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x01, 0x01, 0x09, 0x09, 0x0a, 0x0d, 0x13, 0x02, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x1d, 0x0e, 0x02, 0x1e, 0x1a, 0x1a, 0x1c, 0x20, 0x20, 0x0f, 0x20, 0x18, 0x20, 0x20, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x08, 0x0c, 0x08, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x06, 0x06, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x0a, 0x10, 0x0a, 0x0b, 0x09, 0x0b, 0x0a, 0x17, 0x13, 0x02, 0x11, 0x11, 0x13, 0x13, 0x17, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x17, 0x13, 0x13, 0x02, 0x12, 0x1d, 0x0e, 0x1e, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0e, 0x20, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0c, 0x09, 0x0c, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x09, 0x0a, 0x10, 0x0a, 0x0a, 0x0b, 0x0b, 0x0a, 0x0d, 0x13, 0x02, 0x13, 0x13, 0x17, 0x10, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x10, 0x02, 0x13, 0x11, 0x12, 0x0e, 0x1e, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x1d, 0x1f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05, 0x07, 0x0c, 0x09, 0x0c, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0d, 0x02, 0x17, 0x0d, 0x0a, 0x0b, 0x09, 0x08, 0x07, 0x07, 0x07, 0x06, 0x07, 0x08, 0x09, 0x02, 0x0d, 0x17, 0x1f, 0x12, 0x0e, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x13, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x01, 0x05, 0x07, 0x09, 0x0c, 0x08, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x0b, 0x0a, 0x02, 0x0a, 0x0a, 0x09, 0x08, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x05, 0x06, 0x08, 0x02, 0x0b, 0x0a, 0x0d, 0x13, 0x12, 0x0e, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x0f, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x06, 0x07, 0x09, 0x09, 0x0c, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x06, 0x06, 0x07, 0x08, 0x09, 0x02, 0x09, 0x08, 0x07, 0x05, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x07, 0x02, 0x09, 0x01, 0x01, 0x01, 0x1f, 0x1d, 0x1c, 0x20, 0x20, 0x0e, 0x20, 0x20, 
+	0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x08, 0x09, 0x09, 0x0c, 0x0c, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x06, 0x08, 0x02, 0x08, 0x07, 0x05, 0x04, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x04, 0x05, 0x07, 0x02, 0x01, 0x01, 0x01, 0x01, 0x13, 0x12, 0x1e, 0x1c, 0x20, 0x0f, 0x11, 0x20, 
+	0x01, 0x01, 0x01, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x0f, 0x20, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x09, 0x09, 0x09, 0x0c, 0x08, 0x06, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x07, 0x02, 0x07, 0x06, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x02, 0x01, 0x01, 0x01, 0x0a, 0x17, 0x11, 0x1d, 0x1c, 0x20, 0x20, 0x11, 0x20, 
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x20, 0x20, 0x08, 0x09, 0x01, 0x01, 0x01, 0x0a, 0x0b, 0x09, 0x09, 0x09, 0x0c, 0x08, 0x07, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x05, 0x07, 0x02, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x02, 0x0a, 0x0a, 0x0a, 0x0a, 0x0d, 0x13, 0x12, 0x0e, 0x1c, 0x20, 0x11, 0x0d, 
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x0f, 0x0f, 0x03, 0x03, 0x02, 0x1c, 0x1c, 0x1c, 0x02, 0x20, 0x0a, 0x10, 0x17, 0x02, 0x02, 0x0d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x0c, 0x0c, 0x06, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x07, 0x02, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x02, 0x0d, 0x0d, 0x10, 0x0a, 0x0a, 0x17, 0x1f, 0x12, 0x1d, 0x1c, 0x0f, 0x0d, 
+	0x01, 0x02, 0x02, 0x01, 0x01, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x02, 0x13, 0x02, 0x11, 0x13, 0x02, 0x0a, 0x09, 0x08, 0x09, 0x09, 0x0b, 0x09, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x02, 0x0d, 0x0d, 0x10, 0x0a, 0x0a, 0x0a, 0x17, 0x1f, 0x11, 0x1c, 0x20, 0x0f, 
+	0x02, 0x02, 0x02, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x20, 0x1c, 0x13, 0x13, 0x02, 0x02, 0x02, 0x11, 0x1f, 0x02, 0x0b, 0x08, 0x07, 0x08, 0x09, 0x0b, 0x09, 0x07, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x02, 0x0d, 0x0d, 0x0a, 0x0b, 0x09, 0x09, 0x0a, 0x17, 0x13, 0x1c, 0x20, 0x20, 
+	0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x0a, 0x0d, 0x1c, 0x1c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x02, 0x02, 0x0d, 0x02, 0x07, 0x07, 0x07, 0x08, 0x09, 0x08, 0x07, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x02, 0x0a, 0x0a, 0x09, 0x08, 0x07, 0x07, 0x09, 0x0a, 0x17, 0x13, 0x1c, 0x20, 
+	0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x1c, 0x13, 0x17, 0x17, 0x02, 0x02, 0x17, 0x13, 0x1f, 0x11, 0x12, 0x1d, 0x12, 0x11, 0x11, 0x1f, 0x1f, 0x13, 0x02, 0x02, 0x02, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07, 0x06, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x02, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x09, 0x02, 0x09, 0x07, 0x06, 0x05, 0x05, 0x07, 0x0b, 0x10, 0x17, 0x1c, 0x20, 
+	0x11, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x12, 0x11, 0x02, 0x02, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x11, 0x1f, 0x13, 0x13, 0x13, 0x13, 0x17, 0x02, 0x02, 0x02, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x02, 0x02, 0x06, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x08, 0x02, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05, 0x08, 0x0a, 0x0d, 0x0d, 0x1c, 
+	0x11, 0x01, 0x01, 0x01, 0x02, 0x02, 0x18, 0x1e, 0x0e, 0x02, 0x02, 0x1d, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x0d, 0x0d, 0x0d, 0x0d, 0x17, 0x0d, 0x10, 0x02, 0x02, 0x02, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x02, 0x07, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x06, 0x05, 0x03, 0x03, 0x03, 0x04, 0x06, 0x09, 0x0a, 0x0d, 0x0a, 
+	0x13, 0x0e, 0x01, 0x01, 0x19, 0x02, 0x02, 0x1e, 0x02, 0x02, 0x1d, 0x12, 0x11, 0x1f, 0x13, 0x17, 0x17, 0x0d, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0a, 0x10, 0x0d, 0x0d, 0x0a, 0x02, 0x02, 0x02, 0x04, 0x04, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x02, 0x08, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x03, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0a, 0x0a, 
+	0x13, 0x1d, 0x01, 0x18, 0x18, 0x18, 0x02, 0x02, 0x02, 0x11, 0x11, 0x1f, 0x13, 0x0d, 0x0a, 0x0b, 0x0b, 0x09, 0x08, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x0d, 0x10, 0x02, 0x09, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x0f, 0x20, 0x02, 0x02, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x03, 0x04, 0x05, 0x02, 0x02, 0x08, 0x07, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x02, 0x06, 0x05, 0x03, 0x03, 0x00, 0x03, 0x04, 0x06, 0x08, 0x09, 0x09, 
+	0x0d, 0x11, 0x0e, 0x1a, 0x1a, 0x1e, 0x1d, 0x11, 0x11, 0x13, 0x13, 0x0d, 0x0a, 0x0b, 0x08, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x05, 0x07, 0x09, 0x0a, 0x10, 0x0d, 0x02, 0x0a, 0x09, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x0f, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x02, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x1c, 0x02, 0x1c, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1c, 0x1c, 0x1c, 0x02, 0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x1c, 0x1c, 0x1c, 0x02, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x02, 0x02, 0x0f, 0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x1c, 0x02, 0x0f, 0x03, 0x0f, 0x0f, 0x02, 0x1c, 0x0f, 0x0f, 0x02, 0x02, 0x1c, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x02, 0x06, 0x05, 0x04, 0x03, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x07, 
+	0x0a, 0x17, 0x11, 0x12, 0x1d, 0x12, 0x11, 0x13, 0x17, 0x0d, 0x0a, 0x0b, 0x08, 0x07, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0a, 0x10, 0x0d, 0x02, 0x02, 0x09, 0x08, 0x06, 0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 0x04, 0x05, 0x06, 0x01, 0x01, 0x01, 0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x04, 0x04, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x02, 0x20, 0x07, 0x07, 0x07, 0x20, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x0f, 0x20, 0x02, 0x1c, 0x1c, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x04, 0x03, 0x00, 0x00, 0x03, 0x03, 0x01, 0x01, 0x07, 0x02, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x03, 0x04, 0x05, 0x05, 0x05, 
+	0x08, 0x0a, 0x17, 0x13, 0x13, 0x13, 0x17, 0x0d, 0x10, 0x0a, 0x09, 0x08, 0x06, 0x04, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x09, 0x0a, 0x0d, 0x0d, 0x0d, 0x0a, 0x0b, 0x02, 0x08, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x05, 0x06, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x07, 0x07, 0x08, 0x08, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0b, 0x0b, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x1c, 0x05, 0x04, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 
+	0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x08, 0x07, 0x06, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x0b, 0x0a, 0x0d, 0x01, 0x01, 0x10, 0x02, 0x0b, 0x08, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x01, 0x01, 0x0b, 0x0a, 0x0a, 0x0a, 0x0b, 0x08, 0x01, 0x01, 0x05, 0x05, 0x06, 0x07, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x13, 0x13, 0x13, 0x20, 0x02, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x10, 0x0d, 0x17, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x17, 0x17, 0x02, 0x10, 0x0a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x0b, 0x07, 0x05, 0x04, 0x03, 0x04, 0x01, 0x01, 0x01, 0x09, 0x02, 0x07, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 
+	0x04, 0x06, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x0b, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x01, 0x01, 0x01, 0x0a, 0x0d, 0x17, 0x17, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x07, 0x08, 0x09, 0x0a, 0x17, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x02, 0x1c, 0x11, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x1f, 0x11, 0x11, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x1f, 0x13, 0x1f, 0x11, 0x20, 0x20, 0x0f, 0x20, 0x02, 0x02, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x20, 0x02, 0x1c, 0x1c, 0x1c, 0x1c, 0x20, 0x02, 0x1c, 0x13, 0x10, 0x09, 0x06, 0x04, 0x04, 0x05, 0x01, 0x01, 0x0b, 0x02, 0x0b, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x02, 0x10, 0x01, 0x01, 0x01, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x17, 0x13, 0x13, 0x17, 0x0d, 0x01, 0x01, 0x01, 0x09, 0x09, 0x0b, 0x10, 0x13, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x02, 0x1c, 0x1c, 0x20, 0x20, 0x20, 0x02, 0x02, 0x1c, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x1c, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x1c, 0x02, 0x1c, 0x1a, 0x18, 0x02, 0x1c, 0x02, 0x1c, 0x0f, 0x0d, 0x09, 0x06, 0x05, 0x05, 0x07, 0x09, 0x0a, 0x10, 0x02, 0x0a, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x09, 0x0a, 0x17, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x08, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x01, 0x01, 0x0b, 0x09, 0x0b, 0x10, 0x13, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x02, 0x1a, 0x1e, 0x1c, 0x1c, 0x1c, 0x02, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x02, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x02, 0x1c, 0x1c, 0x20, 0x20, 0x1e, 0x1e, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x02, 0x0e, 0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x18, 0x18, 0x18, 0x02, 0x18, 0x18, 0x02, 0x1b, 0x18, 0x02, 0x1c, 0x1c, 0x17, 0x09, 0x06, 0x05, 0x06, 0x08, 0x0a, 0x0d, 0x17, 0x02, 0x0a, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0a, 0x17, 0x13, 0x13, 0x02, 0x01, 0x01, 0x01, 0x0b, 0x08, 0x07, 0x06, 0x05, 0x04, 0x05, 0x06, 0x08, 0x01, 0x0a, 0x0d, 0x0d, 0x0d, 0x10, 0x0a, 0x10, 0x0d, 0x17, 0x13, 0x17, 0x01, 0x0b, 0x09, 0x09, 0x0a, 0x13, 0x12, 0x1a, 0x18, 0x19, 0x14, 0x14, 0x19, 0x19, 0x02, 0x02, 0x1a, 0x02, 0x02, 0x18, 0x02, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1a, 0x1e, 0x0e, 0x0e, 0x1e, 0x1a, 0x18, 0x1b, 0x19, 0x02, 0x1b, 0x18, 0x02, 0x1a, 0x1a, 0x02, 0x18, 0x1b, 0x19, 0x02, 0x19, 0x1b, 0x1c, 0x1c, 0x0f, 0x0f, 0x20, 0x1c, 0x1c, 0x18, 0x18, 0x1a, 0x02, 0x02, 0x1e, 0x1a, 0x02, 0x18, 0x1b, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x02, 0x02, 0x18, 0x18, 0x18, 0x02, 0x0e, 0x11, 0x0d, 0x09, 0x06, 0x05, 0x06, 0x08, 0x0a, 0x0d, 0x17, 0x02, 0x0a, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0a, 0x13, 0x1f, 0x11, 0x02, 0x13, 0x17, 0x0d, 0x0a, 0x08, 0x06, 0x05, 0x04, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0d, 0x0d, 0x0d, 0x0a, 0x0b, 0x09, 0x09, 0x0a, 0x0d, 0x17, 0x17, 0x0d, 0x0b, 0x08, 0x08, 0x0b, 0x0d, 0x11, 0x0e, 0x1a, 0x18, 0x1b, 0x1b, 0x1b, 0x18, 0x18, 0x02, 0x02, 0x02, 0x1a, 0x18, 0x02, 0x18, 0x18, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x0e, 0x0e, 0x1e, 0x1e, 0x18, 0x18, 0x1b, 0x1b, 0x02, 0x02, 0x1a, 0x1a, 0x1a, 0x02, 0x18, 0x18, 0x1b, 0x19, 0x02, 0x1b, 0x18, 0x02, 0x1c, 0x1c, 0x1c, 0x1a, 0x18, 0x1a, 0x1a, 0x1e, 0x1e, 0x02, 0x02, 0x02, 0x1a, 0x18, 0x18, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x02, 0x1d, 0x13, 0x0a, 0x08, 0x05, 0x04, 0x05, 0x07, 0x0b, 0x0a, 0x10, 0x0a, 0x02, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0a, 0x17, 0x13, 0x11, 0x02, 0x11, 0x13, 0x17, 0x0a, 0x08, 0x06, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x10, 0x0d, 0x0a, 0x09, 0x07, 0x06, 0x07, 0x08, 0x0b, 0x10, 0x0d, 0x0a, 0x09, 0x07, 0x07, 0x08, 0x0a, 0x17, 0x11, 0x1d, 0x0e, 0x1e, 0x1e, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x02, 0x1e, 0x1e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x0e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x0e, 0x02, 0x0e, 0x1e, 0x1a, 0x1a, 0x1a, 0x18, 0x02, 0x02, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x0e, 0x0e, 0x0e, 0x1d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x1d, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x02, 0x12, 0x11, 0x17, 0x0b, 0x07, 0x04, 0x04, 0x04, 0x06, 0x08, 0x0b, 0x0b, 0x0b, 0x02, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x09, 0x0a, 0x17, 0x1f, 0x02, 0x11, 0x13, 0x17, 0x0a, 0x08, 0x05, 0x04, 0x03, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x0a, 0x0a, 0x09, 0x07, 0x05, 0x05, 0x05, 0x06, 0x08, 0x0b, 0x0a, 0x0b, 0x08, 0x06, 0x05, 0x06, 0x08, 0x0a, 0x17, 0x13, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x1d, 0x1d, 0x1d, 0x1d, 0x02, 0x1d, 0x12, 0x11, 0x11, 0x1f, 0x1f, 0x11, 0x11, 0x11, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x11, 0x11, 0x12, 0x1d, 0x1d, 0x1d, 0x12, 0x12, 0x02, 0x12, 0x12, 0x12, 0x1d, 0x1d, 0x0e, 0x0e, 0x0e, 0x0e, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x02, 0x13, 0x17, 0x0a, 0x08, 0x06, 0x04, 0x03, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0a, 0x17, 0x02, 0x13, 0x17, 0x0a, 0x09, 0x07, 0x05, 0x03, 0x03, 0x03, 0x03, 0x05, 0x06, 0x08, 0x09, 0x08, 0x07, 0x05, 0x04, 0x03, 0x03, 0x04, 0x06, 0x07, 0x08, 0x08, 0x06, 0x05, 0x04, 0x05, 0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x10, 0x0d, 0x0d, 0x17, 0x13, 0x13, 0x1f, 0x11, 0x11, 0x02, 0x1f, 0x13, 0x0d, 0x10, 0x0a, 0x0a, 0x0a, 0x10, 0x10, 0x10, 0x0a, 0x0a, 0x0a, 0x10, 0x0d, 0x0d, 0x17, 0x13, 0x13, 0x13, 0x13, 0x13, 0x02, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x13, 0x13, 0x17, 0x17, 0x17, 0x13, 0x13, 0x17, 0x17, 0x0d, 0x0a, 0x0b, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x02, 0x10, 0x0a, 0x09, 0x07, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x07, 0x08, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0a, 0x02, 0x10, 0x0a, 0x0b, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x05, 0x05, 0x04, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x08, 0x09, 0x0b, 0x0a, 0x0a, 0x0d, 0x17, 0x17, 0x02, 0x0d, 0x0a, 0x0b, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0b, 0x0a, 0x0a, 0x0a, 0x10, 0x10, 0x02, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x10, 0x0d, 0x17, 0x13, 0x13, 0x17, 0x0d, 0x10, 0x0a, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x09, 0x08, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x02, 0x0b, 0x09, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x09, 0x02, 0x0b, 0x09, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x08, 0x0b, 0x0a, 0x0a, 0x02, 0x0b, 0x08, 0x07, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0b, 0x02, 0x09, 0x08, 0x08, 0x07, 0x08, 0x09, 0x0b, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x09, 0x07, 0x07, 0x06, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x06, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x02, 0x08, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x02, 0x07, 0x06, 0x05, 0x04, 0x03, 0x03, 0x03, 0x04, 0x04, 0x01, 0x01, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x08, 0x02, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x02, 0x08, 0x07, 0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x02, 0x07, 0x06, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x07, 0x07, 0x02, 0x06, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x02, 0x07, 0x06, 0x05, 0x04, 0x03, 0x03, 0x04, 0x01, 0x01, 0x01, 0x02, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x07, 0x02, 0x06, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x02, 0x06, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x02, 0x06, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x02, 0x07, 0x06, 0x05, 0x04, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x05, 0x07, 0x07, 0x02, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x01, 0x01, 0x01, 0x05, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x02, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x02, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x09, 0x01, 0x01, 0x01, 0x06, 0x06, 0x08, 0x0a, 0x13, 0x01, 0x01, 0x01, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x01, 0x01, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x01, 0x01, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x01, 0x01, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x09, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0b, 0x01, 0x01, 0x01, 0x08, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0b, 0x09, 0x08, 0x06, 0x04, 0x03, 0x03, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x09, 0x09, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x09, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x09, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x09, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x09, 0x07, 0x05, 0x03, 0x03, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0b, 0x09, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0b, 0x09, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0b, 0x09, 0x08, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x08, 0x05, 0x04, 0x03, 0x03, 0x03, 0x05, 0x07, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x09, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x09, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x09, 0x07, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x09, 0x0b, 0x0b, 0x09, 0x07, 0x05, 0x04, 0x03, 0x00, 0x03, 0x04, 0x06, 0x07, 0x09, 0x0b, 0x0b, 0x0a, 0x01, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x08, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x08, 0x08, 0x08, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0b, 0x01, 0x13, 0x12, 0x1e, 0x01, 0x01, 0x02, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x09, 0x0b, 0x0b, 0x09, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x09, 0x0b, 0x0b, 0x09, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x09, 0x0b, 0x0b, 0x09, 0x07, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0a, 0x13, 0x12, 0x01, 0x01, 0x02, 0x02, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x08, 0x08, 0x08, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x08, 0x08, 0x08, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x08, 0x08, 0x08, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x06, 0x08, 0x0a, 0x13, 0x12, 0x01, 0x01, 0x02, 0x02, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x0b, 0x17, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x01, 0x0a, 0x13, 0x12, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0d, 0x11, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x0b, 0x17, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
+	0x03, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x0b, 0x17, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
+	0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x10, 0x13, 0x01, 0x1a, 0x01, 0x01, 0x02, 0x02, 0x02, 
+	0x01, 0x01, 0x01, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x07, 0x0b, 0x17, 0x11, 0x1e, 0x18, 0x01, 0x01, 0x01, 0x02, 
+	0x01, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0a, 0x1f, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 
+	0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x17, 0x11, 0x01, 0x18, 0x18, 0x01, 0x01, 
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x0a, 0x13, 0x1d, 0x1e, 0x01, 0x01, 0x01, 
+	0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x0d, 0x1f, 0x1d, 0x01, 0x01, 0x01, 
+	0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x0b, 0x17, 0x11, 0x12, 0x01, 0x01, 
+	0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0a, 0x13, 0x01, 0x01, 0x01, 
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x08, 0x06, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x01, 0x01, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x0b, 0x0d, 0x01, 0x01, 0x01, 
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x01, 0x01, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x01, 0x01, 0x01, 0x01, 0x02, 
+	0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x05, 0x01, 0x05, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x07, 0x08, 0x09, 0x01, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x01, 0x01, 0x01, 0x02, 0x02, 
+	0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x0f, 0x20, 0x20, 0x0f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x02, 0x02, 0x02, 0x06, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0b, 0x02, 0x02, 0x02, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x09, 0x01, 0x01, 0x02, 0x02, 
+	0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x1c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x02, 0x02, 0x0f, 0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x02, 0x02, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x1c, 0x1c, 0x02, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x0f, 0x1c, 0x1c, 0x02, 0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1c, 0x02, 0x0f, 0x03, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x04, 0x05, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x1c, 0x1c, 0x01, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x08, 0x08, 0x08, 0x07, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x1c, 0x02, 0x02, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x04, 0x04, 0x04, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x04, 0x04, 0x04, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x04, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x1c, 0x01, 0x01, 0x01, 0x01, 
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x0b, 0x09, 0x08, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x07, 0x07, 0x20, 0x20, 0x06, 0x06, 0x06, 0x07, 0x07, 0x06, 0x20, 0x20, 0x20, 0x08, 0x0b, 0x0d, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x07, 0x07, 0x07, 0x07, 0x20, 0x20, 0x07, 0x07, 0x20, 0x20, 0x20, 0x20, 0x02, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x08, 0x07, 0x07, 0x07, 0x06, 0x20, 0x20, 0x20, 0x06, 0x07, 0x07, 0x07, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x07, 0x20, 0x20, 0x07, 0x07, 0x20, 0x07, 0x07, 0x20, 0x20, 0x08, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x06, 0x06, 0x06, 0x06, 0x07, 0x20, 0x20, 0x20, 0x1c, 0x01, 0x01, 0x1c, 
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x1c, 0x20, 0x20, 0x0d, 0x17, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x02, 0x20, 0x0b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0b, 0x0b, 0x20, 0x20, 0x20, 0x20, 0x0b, 0x0a, 0x0d, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x0a, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x01, 0x01, 0x1c, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x09, 0x0b, 0x0a, 0x10, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x0f, 0x0a, 0x0b, 0x0b, 0x0f, 0x20, 0x20, 0x10, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x1c, 0x01, 0x01, 0x1c, 
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x20, 0x20, 0x0f, 0x11, 0x12, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x02, 0x1c, 0x20, 0x1c, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x13, 0x13, 0x20, 0x20, 0x0f, 0x0f, 0x0f, 0x20, 0x17, 0x13, 0x0f, 0x20, 0x20, 0x1c, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x1c, 0x20, 
+};
 
-	// boot stage
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0x9def, 0x7de7, 0x5de7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0xbad6, 0x5ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0xbad6, 0x5ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x0000, 0x0000, 0x0000, 0xaaec, 0xaaec, 0x0000, 0x0000, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xdbd6, 0xdad6, 0x9ace, 0x1cdf, 0x2c3d, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0x0000, 0x29d4, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x29d4, 0x0000, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbeef, 0x9def, 0xbace, 0x3cdf, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0x2c3d, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbef7, 0x0000, 0xaaec, 0x29d4, 0x0000, 0x0000, 0xaaec, 0x0000, 0x0000, 0x29d4, 0xaaec, 0x0000, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbef7, 0xdbd6, 0x7de7, 0x3ce7, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x58c6, 0x38c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0x2c3d, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbeef, 0x0000, 0x83db, 0x0000, 0x3ce7, 0x1cdf, 0x0000, 0x1cdf, 0x3ce7, 0x0000, 0x83db, 0x0000, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xbef7, 0xfbd6, 0x7def, 0x5ce7, 0x1bdf, 0x2c3d, 0x2c3d, 0x79ce, 0xb6b5, 0x58c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x38c6, 0xab34, 0x58c6, 0x58c6, 0x58c6, 0x2c3d, 0x58c6, 0x58c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0x1bdf, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x0000, 0x0000, 0x83db, 0x0000, 0xfbde, 0x0000, 0xdbd6, 0x0000, 0xfbde, 0x0000, 0x83db, 0x0000, 0x0000, 0xbeef, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0x2c3d, 0xbace, 0x99ce, 0xd6b5, 0x59c6, 0x2c3d, 0x2c3d, 0x58c6, 0x58c6, 0x59c6, 0xb6b5, 0x59c6, 0x79c6, 0x79c6, 0x79c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0x2c3d, 0x2c3d, 0xdbd6, 0x1bdf, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xfbde, 0x0000, 0x7de7, 0x3ce7, 0x0000, 0x0000, 0xdbd6, 0xdad6, 0xbad6, 0xbad6, 0xdad6, 0x0000, 0x0000, 0x3ce7, 0x7de7, 0x0000, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0x9eef, 0x7de7, 0x3ce7, 0x38c6, 0xdad6, 0x9ace, 0xf7b5, 0x2c3d, 0x2c3d, 0xd6b5, 0x79ce, 0x79ce, 0x79ce, 0x99ce, 0xf7bd, 0x99ce, 0x9ace, 0x99ce, 0x99ce, 0x79ce, 0x59c6, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x2aaf, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x0000, 0x0000, 0x0000, 0x1cdf, 0x0000, 0xdad6, 0x0000, 0x0000, 0xbad6, 0x0000, 0x0000, 0xdad6, 0x0000, 0x1cdf, 0x0000, 0x0000, 0x0000, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x99ce, 0x1bdf, 0xfbd6, 0xdad6, 0x17be, 0xbace, 0x9ace, 0xf7bd, 0x9ace, 0xbace, 0xbad6, 0xdad6, 0xdad6, 0x38be, 0xdad6, 0xdad6, 0xbad6, 0x9ace, 0x79ce, 0x79c6, 0x79c6, 0x247a, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xbef7, 0x0000, 0x29d4, 0x0000, 0x3cdf, 0x0000, 0x0000, 0xdad6, 0x0000, 0xdad6, 0x0000, 0xdad6, 0x0000, 0xdad6, 0x0000, 0x0000, 0x3cdf, 0x0000, 0x29d4, 0x0000, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0xbace, 0x3ce7, 0x1cdf, 0xfbde, 0x38c6, 0xdbd6, 0xdbd6, 0xdad6, 0x38c6, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1cdf, 0x59c6, 0x58c6, 0x38c6, 0xdad6, 0xbace, 0x99ce, 0x79ce, 0x247a, 0x247a, 0x2aaf, 0x2aaf, 0x3cdf, 0x2c3d, 0x2c3d, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbef7, 0x0000, 0xaaec, 0x29d4, 0x83db, 0x0000, 0xfbde, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbde, 0xfbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbde, 0x0000, 0x83db, 0x29d4, 0xaaec, 0x0000, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0xdad6, 0x7de7, 0x5ce7, 0x3ce7, 0x79ce, 0x1cdf, 0x1bdf, 0x1bdf, 0x79ce, 0x3ce7, 0x5ce7, 0x5ce7, 0x5de7, 0x5de7, 0x9ace, 0x3ce7, 0x3cdf, 0x58c6, 0xdbd6, 0xbad6, 0x9ace, 0x9ace, 0x247a, 0x2aaf, 0xfbd6, 0xfbde, 0x1bdf, 0x3cdf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbeef, 0x0000, 0xaaec, 0x23cb, 0x0000, 0xfbde, 0xfbd6, 0x38c6, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0x38c6, 0xfbd6, 0xfbde, 0x0000, 0x23cb, 0xaaec, 0x0000, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x9def, 0x7def, 0x7de7, 0xbace, 0x5de7, 0x5ce7, 0x5ce7, 0x5de7, 0xbad6, 0x7def, 0x9def, 0x9def, 0x9def, 0xdad6, 0x7def, 0xbace, 0x79ce, 0x1bdf, 0xfbd6, 0xdad6, 0xbad6, 0x2aaf, 0x2aaf, 0x247a, 0xfbd6, 0xfbde, 0x1bdf, 0x3ce7, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9def, 0x0000, 0xaaec, 0x0000, 0xfbde, 0xfbde, 0xfbde, 0x58c6, 0x59c6, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x59c6, 0x58c6, 0xfbde, 0xfbde, 0xfbde, 0x0000, 0xaaec, 0x0000, 0x9def, 0xbeef, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xfbde, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0xdbd6, 0x9def, 0x7def, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xfbd6, 0xdbd6, 0xdad6, 0xbad6, 0x5ce7, 0x1cdf, 0xfbde, 0xdbd6, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0xfbde, 0x1bdf, 0x3ce7, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0xfbde, 0x9eef, 0x0000, 0xaaec, 0xaaec, 0x0000, 0xfbd6, 0xfbde, 0x1bdf, 0x79ce, 0x79ce, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x79ce, 0x1bdf, 0xfbde, 0xfbd6, 0x0000, 0xaaec, 0xaaec, 0x0000, 0x9eef, 0xfbde, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xfbde, 0xfbde, 0xfbde, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0xdbd6, 0x7def, 0x5de7, 0x1cdf, 0xfbde, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0x1cdf, 0x5ce7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0xfbd6, 0x9def, 0x0000, 0xaaec, 0xaaec, 0x0000, 0xfbd6, 0x1bdf, 0x3ce7, 0x9ace, 0xbace, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbace, 0x9ace, 0x3ce7, 0x1bdf, 0xfbd6, 0x0000, 0xaaec, 0xaaec, 0x0000, 0x9def, 0xfbd6, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xdbd6, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0xdbd6, 0x7de7, 0x0000, 0x83db, 0xaaec, 0x0000, 0xfbde, 0x1cdf, 0x5ce7, 0xbad6, 0xdad6, 0xdbd6, 0x0000, 0x0000, 0x0000, 0xdbd6, 0xdad6, 0xbad6, 0x5ce7, 0x1cdf, 0xfbde, 0x0000, 0xaaec, 0x83db, 0x0000, 0x7de7, 0xdbd6, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x5de7, 0x79ce, 0xfbde, 0xdbd6, 0xdbd6, 0xfbde, 0x247a, 0xa8c3, 0x7def, 0x9eef, 0x2aaf, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x5de7, 0x0000, 0x83db, 0x83db, 0x0000, 0xfbde, 0x3ce7, 0x7de7, 0x9def, 0xdbd6, 0x0000, 0xfbd6, 0xdbd6, 0xfbd6, 0x0000, 0xdbd6, 0xdbd6, 0x7de7, 0x3ce7, 0xfbde, 0x0000, 0x83db, 0x83db, 0x0000, 0x5de7, 0xdbd6, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0xbad6, 0x99ce, 0x59c6, 0xdbd6, 0xdbd6, 0x2c3d, 0x247a, 0xa8c3, 0xaaec, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5ce7, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x5ce7, 0x9def, 0x9eef, 0xbeef, 0xfbd6, 0xdbd6, 0x9eef, 0x9eef, 0xfbd6, 0xfbd6, 0x9eef, 0x9def, 0x5ce7, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x5ce7, 0x9def, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xbef7, 0xbeef, 0xdad6, 0xab34, 0x79c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0x2aaf, 0x2aaf, 0xbef7, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x0000, 0x0000, 0x0000, 0xbeef, 0x9eef, 0x9eef, 0xdbd6, 0xdbd6, 0x9eef, 0xbeef, 0x0000, 0x0000, 0x0000, 0x0000, 0x83db, 0x83db, 0x83db, 0x0000, 0x3ce7, 0x7def, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 0xbeef, 0x2c3d, 0xab34, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0x7def, 0x3ce7, 0x0000, 0x83db, 0x83db, 0x0000, 0x1bdf, 0x5ce7, 0x7def, 0x9eef, 0x0000, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x0000, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0x0000, 0x83db, 0x83db, 0x0000, 0x3ce7, 0x7def, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0x9eef, 0xbad6, 0x3ce7, 0x0000, 0x83db, 0x0000, 0x38be, 0xfbde, 0x3ce7, 0x0000, 0x7def, 0x9def, 0x0000, 0x9def, 0x7def, 0x9def, 0x0000, 0x9def, 0x7def, 0x0000, 0x3ce7, 0xfbde, 0x38be, 0x0000, 0x83db, 0x0000, 0x3ce7, 0xbad6, 0x9eef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xfbde, 0xfbde, 0xfbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0x9eef, 0xbad6, 0x3ce7, 0xfbd6, 0x0000, 0xbace, 0x18be, 0xfbde, 0x3cdf, 0x5ce7, 0x0000, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0x0000, 0x5ce7, 0x3cdf, 0xfbde, 0x18be, 0xbace, 0x0000, 0xfbd6, 0x3ce7, 0xbad6, 0x9eef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0xab34, 0xab34, 0xab34, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x7def, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0xbad6, 0x3ce7, 0xfbde, 0x0000, 0xbad6, 0x38be, 0xfbde, 0x0000, 0x3ce7, 0x5de7, 0x0000, 0x0000, 0x7def, 0x7def, 0x7def, 0x7de7, 0x0000, 0x5de7, 0x3ce7, 0x0000, 0xfbde, 0x38be, 0xbad6, 0x0000, 0xfbde, 0x3ce7, 0xbad6, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xab34, 0xab34, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0xaaec, 0xaaec, 0xbef7, 0xbeef, 0x2aaf, 0x2aaf, 0x5de7, 0x5ce7, 0x5de7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0xdad6, 0x5ce7, 0x1bdf, 0x0000, 0xdbd6, 0x38c6, 0x1bdf, 0x3cdf, 0x0000, 0x0000, 0x0000, 0x5de7, 0x5de7, 0x7de7, 0x5de7, 0x5de7, 0x0000, 0x0000, 0x0000, 0x3cdf, 0x1bdf, 0x38c6, 0xdbd6, 0x0000, 0x1bdf, 0x5ce7, 0xdad6, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x699e, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0x3ce7, 0x5ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0xdad6, 0x5de7, 0x3cdf, 0x0000, 0xfbde, 0x59c6, 0x0000, 0x3ce7, 0x3ce7, 0x3ce7, 0x0000, 0x0000, 0x0000, 0x5ce7, 0x0000, 0x0000, 0x0000, 0x3ce7, 0x3ce7, 0x3ce7, 0x0000, 0x59c6, 0xfbde, 0x0000, 0x3cdf, 0x5de7, 0xdad6, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0xaaec, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x7de7, 0x3ce7, 0x0000, 0x0000, 0x79ce, 0x3ce7, 0x0000, 0x0000, 0x0000, 0x79ce, 0x3cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x79ce, 0x0000, 0x0000, 0x0000, 0x3ce7, 0x79ce, 0x0000, 0x0000, 0x3ce7, 0x7de7, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xab34, 0xab34, 0xab34, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0xab34, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x1bdf, 0x247a, 0x247a, 0xaaec, 0x3ce7, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0xdbd6, 0x7def, 0x0000, 0xaaec, 0x83db, 0x0000, 0x5ce7, 0x3ce7, 0x3ce7, 0x0000, 0x79c6, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3cdf, 0x79ce, 0x0000, 0x3ce7, 0x3ce7, 0x5ce7, 0x0000, 0x83db, 0xaaec, 0x0000, 0x7def, 0xdbd6, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xab34, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x699e, 0x699e, 0x699e, 0x699e, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xdbd6, 0xfbde, 0x1bdf, 0x247a, 0x247a, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0x5de7, 0xa8c3, 0xaaec, 0xbeef, 0xbef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0xdbd6, 0x7def, 0x0000, 0xaaec, 0xaaec, 0x23cb, 0x0000, 0x0000, 0x0000, 0x83db, 0x0000, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3cdf, 0x0000, 0x83db, 0x0000, 0x0000, 0x0000, 0x23cb, 0xaaec, 0xaaec, 0x0000, 0x7def, 0xdbd6, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xfbde, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x699e, 0x699e, 0x699e, 0x2aaf, 0x2aaf, 0x699e, 0x2aaf, 0x2aaf, 0x2aaf, 0xbad6, 0xdad6, 0xdbd6, 0xfbd6, 0xdbd6, 0x247a, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0x3ce7, 0x7de7, 0xa8c3, 0xaaec, 0xaaec, 0x247a, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xaaec, 0xaaec, 0xbef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0xdef7, 
-	0xdef7, 0xdef7, 0xbef7, 0xdbd6, 0x7def, 0x0000, 0xaaec, 0xaaec, 0x29d4, 0x83db, 0x83db, 0x83db, 0x83db, 0x23cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23cb, 0x83db, 0x83db, 0x83db, 0x83db, 0x29d4, 0xaaec, 0xaaec, 0x0000, 0x7def, 0xdbd6, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbef7, 0xdbd6, 0x7def, 0x7de7, 0x5ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x38c6, 0x2c3d, 0x2c3d, 0x38c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x96ad, 0x96ad, 0x699e, 0x58c6, 0x96ad, 0x2aaf, 0x2aaf, 0xb6b5, 0x2aaf, 0x2aaf, 0xbace, 0xdad6, 0xdbd6, 0xdbd6, 0xdad6, 0xbad6, 0xbace, 0x2aaf, 0x247a, 0x247a, 0xaaec, 0x3ce7, 0x5de7, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0x2aaf, 0xbef7, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x7de7, 0x3ce7, 0x0000, 0x83db, 0x23cb, 0x83db, 0x83db, 0x83db, 0x83db, 0x23cb, 0x83db, 0x83db, 0x83db, 0x83db, 0x83db, 0x23cb, 0x83db, 0x83db, 0x83db, 0x83db, 0x23cb, 0x83db, 0x0000, 0x3ce7, 0x7de7, 0xdbd6, 0xfbde, 0xfbde, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xfbde, 0x9def, 0x7de7, 0x3ce7, 0x1cdf, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x38c6, 0x2c3d, 0x2c3d, 0x58c6, 0x2c3d, 0x2c3d, 0x58c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x58c6, 0xb6b5, 0xb6b5, 0x59c6, 0x699e, 0xb6b5, 0x59c6, 0x2aaf, 0xb6b5, 0x79c6, 0x2aaf, 0x9ace, 0xdad6, 0xdbd6, 0xfbd6, 0xdbd6, 0xdad6, 0x2c3d, 0x2c3d, 0x9ace, 0xbace, 0xdad6, 0x247a, 0x247a, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0x247a, 0x2aaf, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0x2c3d, 0x2c3d, 0x9eef, 0x9eef, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x5de7, 0x1cdf, 0xfbde, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23cb, 0x83db, 0x83db, 0x0000, 0x83db, 0x83db, 0x23cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfbde, 0x1cdf, 0x5de7, 0xdbd6, 0xfbde, 0xfbde, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xfbd6, 0x9def, 0x5de7, 0x3cdf, 0xfbde, 0xdbd6, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0x59c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x58c6, 0x59c6, 0x59c6, 0x59c6, 0x59c6, 0x59c6, 0x59c6, 0x59c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xd6b5, 0x79ce, 0x79ce, 0xd7b5, 0xd7b5, 0xd7b5, 0xd7b5, 0x79ce, 0x99ce, 0x9ace, 0xdad6, 0xfbd6, 0x1bdf, 0x1bdf, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x9ace, 0xbace, 0xbad6, 0xdbd6, 0xfbde, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x5de7, 0x5de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xaaec, 0xbef7, 0xbef7, 0xbef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7def, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0xdad6, 0x5ce7, 0x1bdf, 0x0000, 0xbad6, 0xf7bd, 0xbace, 0xbace, 0xbace, 0xbad6, 0x0000, 0x83db, 0x0000, 0xfbde, 0x0000, 0x83db, 0x0000, 0xbad6, 0xbace, 0xbace, 0xbace, 0xf7bd, 0xbad6, 0x0000, 0x1bdf, 0x5ce7, 0xdad6, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbde, 0x9def, 0xbace, 0x79ce, 0xfbde, 0xdad6, 0xbace, 0x2c3d, 0x2c3d, 0x59c6, 0x59c6, 0x2c3d, 0x58c6, 0x58c6, 0x2c3d, 0x2c3d, 0x79c6, 0x79ce, 0x79ce, 0x99ce, 0xf7b5, 0xf7b5, 0xd7b5, 0x79ce, 0x2c3d, 0x59c6, 0x2c3d, 0x2c3d, 0x79ce, 0xf7bd, 0xbace, 0x17be, 0x17be, 0x17be, 0x17be, 0xbace, 0xbace, 0x17be, 0xdad6, 0xfbde, 0x1cdf, 0x3ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbad6, 0xbad6, 0xbad6, 0xdad6, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0x2aaf, 0x247a, 0xa8c3, 0xfbde, 0x1bdf, 0x1cdf, 0xa8c3, 0xa8c3, 0xaaec, 0x1cdf, 0x1cdf, 0x1cdf, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xaaec, 0xaaec, 0x2aaf, 0x2aaf, 0xbeef, 0xbef7, 0x2aaf, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x5de7, 0x0000, 0xdbd6, 0xbad6, 0xf7bd, 0x9ace, 0x9ace, 0x0000, 0x9ace, 0x17be, 0x0000, 0xdad6, 0xdbd6, 0xdad6, 0x0000, 0x17be, 0x9ace, 0x0000, 0x9ace, 0x9ace, 0xf7bd, 0xbad6, 0xdbd6, 0x0000, 0x5de7, 0xdbd6, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xbad6, 0x99ce, 0x79c6, 0xdbd6, 0xbad6, 0x2c3d, 0x79ce, 0x79ce, 0x79c6, 0x2c3d, 0x59c6, 0x79c6, 0x79ce, 0x79ce, 0x99ce, 0xbace, 0xbad6, 0x18be, 0x18be, 0x18be, 0x17be, 0xf7bd, 0x79ce, 0x79ce, 0x2c3d, 0x99ce, 0xbace, 0x18be, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0xfbd6, 0x38c6, 0xfbde, 0x59c6, 0x3cdf, 0x5ce7, 0x5de7, 0x5de7, 0x5ce7, 0x1cdf, 0xfbde, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9ace, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x5de7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbace, 0xbace, 0xbace, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5de7, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0x9eef, 0xbad6, 0x99ce, 0x59c6, 0xdbd6, 0xbad6, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0xf7bd, 0x17be, 0xdad6, 0xdbd6, 0xfbde, 0x58c6, 0xfbde, 0xfbde, 0xfbd6, 0x38be, 0x17be, 0x9ace, 0x9ace, 0xbad6, 0xdbd6, 0xfbde, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x3ce7, 0x79ce, 0x3ce7, 0x5ce7, 0x9ace, 0x7de7, 0x7def, 0x7def, 0x9ace, 0x79ce, 0x79c6, 0x1bdf, 0x1bdf, 0x1bdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x99ce, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xbad6, 0xbad6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xbef7, 0xbef7, 0xdbd6, 0x7de7, 0x3ce7, 0x1bdf, 0xfbd6, 0x38be, 0xdad6, 0xbad6, 0xbace, 0xbace, 0xf7bd, 0xbace, 0xbace, 0xbace, 0xbace, 0xbace, 0xf7bd, 0xbace, 0xbace, 0xbad6, 0xdad6, 0x38be, 0xfbd6, 0x1bdf, 0x3ce7, 0x7de7, 0xdbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xfbde, 0xbeef, 0x9eef, 0xbad6, 0x99ce, 0x1bdf, 0xfbd6, 0xdbd6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0x38be, 0xdbd6, 0xfbd6, 0x59c6, 0x79ce, 0x79ce, 0x5ce7, 0x99ce, 0x3ce7, 0x79ce, 0x1bdf, 0x38c6, 0xdbd6, 0xdbd6, 0xfbd6, 0x1bdf, 0x3ce7, 0x5de7, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0x7de7, 0xbad6, 0x7de7, 0x7def, 0xdad6, 0x9def, 0x9def, 0xdad6, 0x7de7, 0x5ce7, 0x79ce, 0x79ce, 0x3ce7, 0x3ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x79ce, 0xa8c3, 0xa8c3, 0xa8c3, 0x9ace, 0xf7bd, 0x17be, 0xbad6, 0xbace, 0x9ace, 0x9ace, 0x247a, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0x5ce7, 0x5de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x247a, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xaaec, 0xaaec, 0xaaec, 0xdbd6, 0xbad6, 0x699e, 0x699e, 0x59c6, 0x58c6, 0x38c6, 0x38c6, 0x38be, 0x38be, 0x18be, 0x38be, 0xdad6, 0xdad6, 0xdad6, 0x38be, 0x18be, 0x38be, 0x38be, 0x699e, 0x699e, 0x38c6, 0x59c6, 0x0000, 0x0000, 0xbad6, 0xdbd6, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0xdbd6, 0xbad6, 0x99ce, 0x3cdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x59c6, 0x1cdf, 0x3ce7, 0x99ce, 0xbace, 0x7def, 0xdad6, 0xdad6, 0xbad6, 0xbace, 0x5ce7, 0x79ce, 0x59c6, 0x1bdf, 0x1cdf, 0x3ce7, 0x7de7, 0x9def, 0x9eef, 0xdbd6, 0xdbd6, 0x9eef, 0x9eef, 0xdbd6, 0x9eef, 0x9eef, 0xfbd6, 0xfbd6, 0xdbd6, 0x9def, 0x7def, 0x5de7, 0x9ace, 0x9ace, 0x9ace, 0x5ce7, 0x3cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0x9ace, 0xf7bd, 0x17be, 0x18be, 0x18be, 0xbad6, 0xbace, 0x99ce, 0x79ce, 0x79ce, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0xa8c3, 0xa8c3, 0xa8c3, 0x83db, 0x29d4, 0x699e, 0x47b3, 0x29d4, 0x59c6, 0x29d4, 0x29d4, 0x29d4, 0x38c6, 0x29d4, 0x29d4, 0xaaec, 0xaaec, 0xaaec, 0x38c6, 0x29d4, 0x29d4, 0x699e, 0xe469, 0x47b3, 0x29d4, 0x0000, 0x29d4, 0x29d4, 0x0000, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xfbde, 0xdbd6, 0xbad6, 0x5de7, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x5ce7, 0x5ce7, 0x9ace, 0x7de7, 0xdad6, 0xdbd6, 0xdbd6, 0xbeef, 0xbeef, 0x9eef, 0xdbd6, 0xdad6, 0xbace, 0x5ce7, 0x9ace, 0x9ace, 0xbad6, 0xdbd6, 0xfbd6, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0x9eef, 0xdbd6, 0x7def, 0xbad6, 0xbad6, 0xbad6, 0x5de7, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0x9ace, 0x17be, 0xbad6, 0xdbd6, 0xdbd6, 0x38c6, 0x38be, 0xbad6, 0xbace, 0xf7bd, 0xd7b5, 0x699e, 0x79ce, 0x79ce, 0x247a, 0xa8c3, 0x2c3d, 0x2c3d, 0x247a, 0x2aaf, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x9eef, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x0000, 0x0000, 0x0000, 0x0000, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0xdbd6, 0xdad6, 0x7def, 0x7def, 0x7def, 0xdad6, 0x9def, 0xdbd6, 0x9eef, 0xfbd6, 0xfbde, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0xdbd6, 0xdad6, 0xdad6, 0xdad6, 0xdbd6, 0xbeef, 0xbef7, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbef7, 0xbeef, 0xfbd6, 0xdbd6, 0xdbd6, 0x9def, 0xdad6, 0x5de7, 0x1cdf, 0xdbd6, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x247a, 0x17be, 0x38be, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x58c6, 0x38c6, 0x38be, 0xbace, 0x9ace, 0x2aaf, 0xd7b5, 0x79ce, 0x79ce, 0x247a, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0x9ace, 0x9ace, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0x7def, 0x5de7, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x3cdf, 0x3cdf, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x0000, 0xa8c3, 0xa8c3, 0x247a, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xbef7, 0xfbde, 0xfbde, 0xfbd6, 0xbeef, 0xbeef, 0xfbd6, 0xbeef, 0xbeef, 0xfbde, 0xfbde, 0xbef7, 0xfbde, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xfbde, 0xbef7, 0xbeef, 0xfbd6, 0xfbd6, 0xfbde, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9def, 0xbace, 0x79c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0xdad6, 0x38c6, 0x79c6, 0x3ce7, 0x99ce, 0x5ce7, 0x99ce, 0x3cdf, 0x59c6, 0xdbd6, 0xdad6, 0x2aaf, 0xf7bd, 0x79ce, 0x79ce, 0x79c6, 0x247a, 0x247a, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x79ce, 0xa8c3, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0x5de7, 0xaaec, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xfbde, 0xfbde, 0xfbde, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x1bdf, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xdbd6, 0xdbd6, 0xfbd6, 0xa8c3, 0x0000, 0xa8c3, 0x0000, 0xa8c3, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0xfbde, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbef7, 0xfbde, 0xdbd6, 0xbace, 0x79c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x38c6, 0x79c6, 0x99ce, 0xbace, 0xdad6, 0x7def, 0xbad6, 0xbace, 0x99ce, 0x1cdf, 0x58c6, 0x699e, 0xbad6, 0xbace, 0x99ce, 0x79ce, 0x79c6, 0x59c6, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xbad6, 0xdad6, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xbace, 0xbace, 0xaaec, 0xaaec, 0xa8c3, 0x0000, 0xa8c3, 0x0000, 0xa8c3, 0xaaec, 0x9ace, 0xdad6, 0x9eef, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xdbd6, 0xbace, 0x3cdf, 0x38c6, 0xf7bd, 0xd6b5, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x58c6, 0x3ce7, 0x7de7, 0x9def, 0x9eef, 0xbeef, 0x9eef, 0xdbd6, 0xbad6, 0x9ace, 0x2aaf, 0x1bdf, 0x58c6, 0xdbd6, 0xdad6, 0xbace, 0x99ce, 0x79ce, 0x2aaf, 0x58c6, 0x58c6, 0x59c6, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0x2c3d, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xaaec, 0xaaec, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0x247a, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x0000, 0x247a, 0x247a, 0x247a, 0x3ce7, 0x7de7, 0xdbd6, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xfbde, 0xdbd6, 0xbad6, 0x79ce, 0x38c6, 0xbace, 0x79ce, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x59c6, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xdbd6, 0xbad6, 0x2aaf, 0x3ce7, 0x79ce, 0x1cdf, 0xfbde, 0xdbd6, 0xbad6, 0x9ace, 0x79ce, 0x2aaf, 0x59c6, 0x2aaf, 0x2aaf, 0x79ce, 0x79ce, 0x79ce, 0x79c6, 0x247a, 0x247a, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0x247a, 0xbace, 0x9ace, 0x247a, 0x247a, 0x247a, 0x99ce, 0x2aaf, 0x2aaf, 0x9ace, 0x247a, 0x247a, 0x2aaf, 0x79ce, 0x247a, 0x247a, 0x79ce, 0x247a, 0xa8c3, 0xa8c3, 0x247a, 0x79ce, 0x79ce, 0x0000, 0x9ace, 0xbad6, 0x38c6, 0x3ce7, 0x7de7, 0x9eef, 0xfbde, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbd6, 0x7def, 0x5ce7, 0x59c6, 0xdad6, 0xf7bd, 0x79ce, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x5de7, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xfbde, 0xbef7, 0xdbd6, 0xdad6, 0x2aaf, 0x5de7, 0x9ace, 0x5ce7, 0x3ce7, 0x1cdf, 0xfbde, 0xdad6, 0xbace, 0x99ce, 0x2aaf, 0x2aaf, 0x79ce, 0x99ce, 0x99ce, 0x99ce, 0x79ce, 0x59c6, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x2aaf, 0x2aaf, 0x9ace, 0x2aaf, 0x2aaf, 0x79ce, 0x99ce, 0x9ace, 0xbace, 0x9ace, 0x99ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x699e, 0xd7b5, 0x699e, 0x2aaf, 0x79c6, 0x79c6, 0x79ce, 0x79ce, 0xf7bd, 0x247a, 0x247a, 0x99ce, 0x79ce, 0x0000, 0x79ce, 0x0000, 0xbad6, 0x58c6, 0x3ce7, 0x7def, 0x9eef, 0xfbde, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0x9eef, 0x7de7, 0x3ce7, 0x38c6, 0xbad6, 0xf7bd, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0xbace, 0x9eef, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0x699e, 0xbad6, 0x7de7, 0x7def, 0x7de7, 0x5de7, 0x3ce7, 0x1bdf, 0xdbd6, 0xbad6, 0xbace, 0xbace, 0x9ace, 0x2aaf, 0x2aaf, 0x9ace, 0x99ce, 0x79ce, 0x59c6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x1bdf, 0x2aaf, 0x2aaf, 0x2aaf, 0x79ce, 0x99ce, 0x9ace, 0xbad6, 0xbad6, 0xbace, 0x9ace, 0x99ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x2aaf, 0xd7b5, 0x79ce, 0x79ce, 0x99ce, 0xf7bd, 0xf7bd, 0xbace, 0xbace, 0x9ace, 0x99ce, 0x0000, 0x99ce, 0x0000, 0xdbd6, 0x1bdf, 0x9ace, 0xdad6, 0xfbd6, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0xfbd6, 0xbad6, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0xbace, 0xdbd6, 0xfbde, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xdad6, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x9def, 0x7def, 0x5de7, 0x3ce7, 0xaaec, 0xaaec, 0xaaec, 0xdad6, 0x2aaf, 0x2aaf, 0x247a, 0xaaec, 0xaaec, 0xaaec, 0x2c3d, 0x2c3d, 0x2aaf, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xfbde, 0xdad6, 0x9ace, 0x99ce, 0x99ce, 0xbace, 0xdad6, 0xdbd6, 0xdbd6, 0x38be, 0x38be, 0x18be, 0x17be, 0xf7bd, 0x9ace, 0x9ace, 0xf7bd, 0xf7bd, 0x99ce, 0x99ce, 0x9ace, 0xbace, 0x17be, 0x18be, 0x18be, 0x18be, 0xbad6, 0xbad6, 0xbad6, 0xbace, 0x0000, 0xdbd6, 0xfbde, 0x3ce7, 0xbace, 0xdbd6, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbef7, 0xdbd6, 0xdad6, 0x5ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x9ace, 0xdbd6, 0xfbde, 0xfbde, 0xdef7, 0xbef7, 0xfbde, 0x9eef, 0x7def, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0x9def, 0x7de7, 0x3ce7, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0x2c3d, 0x247a, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x1bdf, 0xdbd6, 0xbad6, 0xbace, 0xbad6, 0xdbd6, 0x38c6, 0x59c6, 0x59c6, 0x1bdf, 0xfbde, 0xfbde, 0xfbd6, 0x38c6, 0xdbd6, 0xdad6, 0xbad6, 0xbad6, 0xbad6, 0xdad6, 0xdbd6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0xdbd6, 0xdbd6, 0xdbd6, 0x0000, 0xfbde, 0x1cdf, 0x5ce7, 0x7def, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0x9eef, 0xbad6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0x99ce, 0xdad6, 0xfbde, 0xfbde, 0xdef7, 0xbef7, 0xfbde, 0x9def, 0x7de7, 0x2aaf, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0x9def, 0x7def, 0x5ce7, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xfbd6, 0xdbd6, 0xbad6, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x3ce7, 0xfbde, 0xdbd6, 0xdbd6, 0xfbde, 0x1bdf, 0x79ce, 0x3ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x79ce, 0x79ce, 0x79c6, 0xfbde, 0xfbde, 0x38c6, 0x38c6, 0x58c6, 0x1bdf, 0x79ce, 0x3ce7, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x1cdf, 0x1bdf, 0x0000, 0x1bdf, 0x0000, 0x5ce7, 0x7de7, 0x9eef, 0xfbde, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0xdad6, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbad6, 0xfbde, 0x99ce, 0xdad6, 0xfbd6, 0xfbde, 0x1bdf, 0xfbde, 0xfbde, 0xdad6, 0x7de7, 0x2aaf, 0x3ce7, 0x3ce7, 0x2c3d, 0x7de7, 0x9def, 0x9def, 0x7def, 0x5ce7, 0x3cdf, 0x247a, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x38c6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x5de7, 0x3ce7, 0x1cdf, 0x1cdf, 0x3ce7, 0x5ce7, 0xbace, 0x7def, 0x7def, 0x9def, 0x7def, 0x7def, 0x7def, 0x7de7, 0x9ace, 0x3ce7, 0x3ce7, 0x79ce, 0x79ce, 0x99ce, 0x5de7, 0xbace, 0x7de7, 0xbad6, 0xbace, 0xbace, 0x9ace, 0x5ce7, 0x3ce7, 0x0000, 0x3ce7, 0x0000, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0xdad6, 0x3ce7, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x99ce, 0xbad6, 0xfbde, 0x99ce, 0xdad6, 0xfbd6, 0xfbde, 0x1bdf, 0xfbde, 0xfbd6, 0xdad6, 0x9ace, 0x2aaf, 0x1cdf, 0x1cdf, 0x3ce7, 0x5de7, 0x7def, 0x7def, 0x7de7, 0x5ce7, 0x1cdf, 0xfbde, 0x2aaf, 0xdad6, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0x58c6, 0xa8c3, 0x38c6, 0xa8c3, 0x38c6, 0x38c6, 0xa8c3, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 
-	0x7def, 0x7de7, 0x5de7, 0x5de7, 0x7de7, 0x9def, 0xdbd6, 0xdbd6, 0xfbd6, 0xfbde, 0xfbd6, 0xfbd6, 0xdbd6, 0xdbd6, 0x9def, 0x7def, 0x7de7, 0x5de7, 0xbace, 0x7def, 0x9def, 0xdbd6, 0x9eef, 0xdbd6, 0xdbd6, 0xdbd6, 0xdad6, 0x7de7, 0x5de7, 0x5ce7, 0x0000, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0xbad6, 0x3ce7, 0xfbde, 0xbad6, 0x2c3d, 0x99ce, 0x9ace, 0xdbd6, 0x1bdf, 0x5de7, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0xfbde, 0xfbd6, 0x9def, 0x5de7, 0x699e, 0x1bdf, 0x1bdf, 0x1cdf, 0x5ce7, 0x7de7, 0x7def, 0x7de7, 0x2c3d, 0x2c3d, 0xdbd6, 0x2aaf, 0xbace, 0xbace, 0xbace, 0x2aaf, 0xbace, 0x9ace, 0x99ce, 0x2aaf, 0x59c6, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xaaec, 0xa8c3, 0xaaec, 0xaaec, 0x58c6, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0xa8c3, 
-	0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xfbd6, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0xfbde, 0xbef7, 0xfbde, 0xfbde, 0x9eef, 0x9eef, 0x9def, 0xdbd6, 0x9eef, 0xfbd6, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0xdbd6, 0xdbd6, 0x7de7, 0x5de7, 0x0000, 0x5de7, 0x7def, 0xdbd6, 0xfbde, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0xbad6, 0x3ce7, 0xfbde, 0xdad6, 0xbace, 0xbace, 0xdad6, 0xfbde, 0x3ce7, 0x7de7, 0x9eef, 0xfbde, 0x1bdf, 0xdef7, 0xfbde, 0xbeef, 0x9def, 0x9ace, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x5ce7, 0x7de7, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0xbad6, 0x2c3d, 0x2c3d, 0x9ace, 0x9ace, 0x2aaf, 0x9ace, 0x2aaf, 0x2aaf, 0x59c6, 0x59c6, 0x59c6, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x59c6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 
-	0xbef7, 0xbef7, 0xbeef, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xfbde, 0xbef7, 0xfbde, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xfbde, 0xdbd6, 0x7def, 0x0000, 0x5de7, 0x0000, 0xdad6, 0x9eef, 0xbef7, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xfbd6, 0x7def, 0x5ce7, 0x1cdf, 0xdbd6, 0xdad6, 0xdbd6, 0xfbde, 0x3cdf, 0x5de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0xfbde, 0xbeef, 0xdad6, 0x5de7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x5ce7, 0x7de7, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0xbace, 0xbace, 0xbace, 0x2aaf, 0x2aaf, 0x99ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x79ce, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0x59c6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 
-	0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x0000, 0x5de7, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x1bdf, 0x3ce7, 0x5de7, 0x7def, 0xbeef, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x7de7, 0x2c3d, 0x3ce7, 0xfbde, 0x2aaf, 0xdad6, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0x18be, 0x18be, 0xbad6, 0xbace, 0x9ace, 0x9ace, 0x9ace, 0x99ce, 0x99ce, 0x2aaf, 0x79ce, 0x79ce, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x79c6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x7de7, 0x0000, 0x7de7, 0xdad6, 0x9eef, 0xbef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x5ce7, 0x7de7, 0x9def, 0x9eef, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x79ce, 0x79ce, 0x2c3d, 0x2c3d, 0x5de7, 0x5de7, 0x3ce7, 0x1cdf, 0xfbde, 0x2aaf, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdad6, 0xbad6, 0xbace, 0x2aaf, 0x9ace, 0x99ce, 0x99ce, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x79ce, 0xa8c3, 0xa8c3, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x7de7, 0x0000, 0x7de7, 0x7def, 0xdbd6, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x9def, 0x9def, 0xbeef, 0xfbde, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x9ace, 0x3ce7, 0x3cdf, 0x79ce, 0x5ce7, 0x5de7, 0x5ce7, 0x3ce7, 0x1bdf, 0xfbde, 0x2aaf, 0xdbd6, 0xdbd6, 0xfbde, 0x58c6, 0x1bdf, 0x1cdf, 0x1cdf, 0x1cdf, 0x79c6, 0x1cdf, 0x1bdf, 0xfbde, 0x38c6, 0x699e, 0xdad6, 0xbad6, 0xbace, 0x9ace, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xbace, 0xa8c3, 
-	0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x0000, 0x5de7, 0x0000, 0x7def, 0xdbd6, 0xbef7, 0xfbde, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdad6, 0xbace, 0x3ce7, 0x3cdf, 0x79ce, 0x3ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x1cdf, 0xfbde, 0x2aaf, 0xfbde, 0xfbde, 0x59c6, 0x79ce, 0x79ce, 0x5ce7, 0x99ce, 0x5ce7, 0x9ace, 0x9ace, 0x5ce7, 0x99ce, 0x3cdf, 0x699e, 0x38c6, 0xdbd6, 0xdad6, 0xbace, 0x9ace, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xbad6, 0xfbd6, 
-	0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0xbeef, 0x9eef, 0x7def, 0x0000, 0x5de7, 0x0000, 0x7def, 0x9eef, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xfbde, 0xfbde, 0xdbd6, 0xbad6, 0x5ce7, 0x3ce7, 0x79ce, 0x5ce7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x1cdf, 0x2aaf, 0x1bdf, 0x79c6, 0x3ce7, 0x9ace, 0xbace, 0xbad6, 0xbad6, 0x7def, 0xdad6, 0x9def, 0xdad6, 0xbad6, 0x9ace, 0x2aaf, 0x1cdf, 0x59c6, 0xfbd6, 0xdad6, 0xbace, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xfbde, 
-	0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x9eef, 0x7def, 0x5de7, 0x0000, 0x7de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0x7de7, 0xbace, 0x9ace, 0x5de7, 0x7de7, 0x7de7, 0x7de7, 0x5ce7, 0x79ce, 0x699e, 0x79ce, 0x99ce, 0x5de7, 0xbad6, 0x9def, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0xfbd6, 0xdbd6, 0xdbd6, 0xbad6, 0x2aaf, 0x5ce7, 0x79ce, 0x1cdf, 0xfbde, 0xdad6, 0xbace, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 
-	0xdef7, 0x2c3d, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbeef, 0x2c3d, 0x2c3d, 0x9def, 0x7def, 0x5de7, 0x5de7, 0x0000, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xfbde, 0xbef7, 0xbeef, 0xdbd6, 0x9def, 0x7def, 0x7def, 0x9def, 0x9def, 0x7def, 0xbad6, 0x5de7, 0x699e, 0x5de7, 0xbace, 0xdad6, 0xdbd6, 0xfbd6, 0xfbde, 0xfbde, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0xdbd6, 0xdad6, 0x699e, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbd6, 0xbad6, 0x247a, 0xa8c3, 0xa8c3, 0xbace, 0xa8c3, 0xa8c3, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xaaec, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7def, 0x7de7, 0xbace, 0x5de7, 0x0000, 0x0000, 0x0000, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xdbd6, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0xdad6, 0xbad6, 0x699e, 0xbad6, 0x7def, 0xdbd6, 0xfbd6, 0xbef7, 0xbef7, 0xbef7, 0x1bdf, 0xbef7, 0xbef7, 0xfbde, 0xdbd6, 0xdad6, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0xdad6, 0x9ace, 0x247a, 0xa8c3, 0xaaec, 0xdbd6, 0xa8c3, 
-	0x2c3d, 0x2c3d, 0xab34, 0xbeef, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xaaec, 0xaaec, 0xa8c3, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0xbace, 0x5de7, 0x5de7, 0x0000, 0x7de7, 0x9def, 0x0000, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xfbde, 0xbef7, 0xfbde, 0xbef7, 0xbef7, 0xbeef, 0xdbd6, 0x7def, 0x2aaf, 0xdad6, 0xdbd6, 0xfbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xfbde, 0xdbd6, 0x7def, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x3ce7, 0x1bdf, 0xdbd6, 0xbad6, 0x247a, 0xa8c3, 0xa8c3, 0xdbd6, 0xa8c3, 
-	0x2c3d, 0x2c3d, 0xab34, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xfbde, 0x699e, 0x2aaf, 0x2aaf, 0xa8c3, 0xa8c3, 0x7de7, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x3ce7, 0x9ace, 0x5de7, 0x5de7, 0x5de7, 0x0000, 0x7de7, 0x7def, 0x0000, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0xdad6, 0x699e, 0xdad6, 0xdbd6, 0xfbde, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0x9def, 0x7de7, 0x2aaf, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1cdf, 0xfbde, 0xdad6, 0xbace, 0x247a, 0xa8c3, 0xdbd6, 0x1cdf, 
-	0x2c3d, 0xab34, 0xab34, 0xab34, 0x2c3d, 0x2c3d, 0xaaec, 0x29d4, 0xbef7, 0xbef7, 0xbef7, 0x29d4, 0x29d4, 0xfbde, 0xfbde, 0x699e, 0xe469, 0x247a, 0x247a, 0x2aaf, 0xa8c3, 0x3ce7, 0x3cdf, 0x1bdf, 0x2aaf, 0x2aaf, 0x79ce, 0x3ce7, 0x5de7, 0x5de7, 0x5de7, 0x5de7, 0x0000, 0x0000, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xbeef, 0x9eef, 0x7def, 0x7def, 0x2aaf, 0x9eef, 0xbeef, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0x9def, 0x5de7, 0x2aaf, 0x79ce, 0x1cdf, 0x3cdf, 0x3ce7, 0x3ce7, 0x1bdf, 0xfbd6, 0xdad6, 0xbad6, 0x247a, 0xaaec, 0x1cdf, 
-	0x2c3d, 0x699e, 0x699e, 0xab34, 0x2c3d, 0xa8c3, 0xa8c3, 0xa8c3, 0x29d4, 0x29d4, 0x29d4, 0x47b3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xfbde, 0x2aaf, 0xdbd6, 0x38c6, 0x2aaf, 0x3ce7, 0x5de7, 0x7de7, 0xbace, 0x5de7, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xbef7, 0xfbde, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9eef, 0xbeef, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9def, 0x5de7, 0x2aaf, 0x79c6, 0x79c6, 0x79ce, 0x3ce7, 0x3ce7, 0x3ce7, 0x1bdf, 0xfbd6, 0xdbd6, 0x247a, 0xa8c3, 0xaaec, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0xa8c3, 0x247a, 0xfbde, 0xfbde, 0x2aaf, 0x2aaf, 0x2aaf, 0x38c6, 0xfbd6, 0x2aaf, 0x5ce7, 0x7de7, 0xbad6, 0x7de7, 0x5de7, 0x5ce7, 0x5de7, 0xbad6, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0xdbd6, 0xfbd6, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbeef, 0x9def, 0x5de7, 0x2aaf, 0x1cdf, 0x79ce, 0x79ce, 0x9ace, 0x5de7, 0x5de7, 0x3ce7, 0x1bdf, 0xfbde, 0x247a, 0xa8c3, 0xa8c3, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x3ce7, 0x1cdf, 0x247a, 0x247a, 0xdbd6, 0xdbd6, 0x38c6, 0x38c6, 0xdbd6, 0x2aaf, 0x2aaf, 0x2aaf, 0x1cdf, 0x2aaf, 0xbad6, 0x7def, 0x7def, 0x7de7, 0x5de7, 0xbace, 0x7def, 0x9def, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0xdbd6, 0xfbd6, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbd6, 0xdad6, 0x7de7, 0x2aaf, 0x3ce7, 0x99ce, 0x9ace, 0xbad6, 0x7def, 0x7def, 0x5de7, 0x3ce7, 0x1bdf, 0xfbde, 0x247a, 0xa8c3, 
-	0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x247a, 0xfbde, 0x1bdf, 0x1bdf, 0x2aaf, 0x2aaf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0xdad6, 0xbad6, 0x38be, 0x38c6, 0x38c6, 0x38c6, 0xfbd6, 0xfbde, 0x2aaf, 0x2aaf, 0x2aaf, 0x7def, 0x9def, 0x9def, 0x7def, 0xbad6, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2aaf, 0xdad6, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0x7de7, 0x5de7, 0x2aaf, 0xbace, 0x7def, 0x9def, 0xdbd6, 0x9eef, 0x7def, 0x5ce7, 0x3cdf, 0x1bdf, 0x247a, 0xa8c3, 
-	0xdbd6, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbad6, 0xdad6, 0xdbd6, 0x2aaf, 0x2aaf, 0xdbd6, 0x38c6, 0x38c6, 0xdbd6, 0xdad6, 0x18be, 0x38be, 0x38c6, 0x38c6, 0x58c6, 0x58c6, 0x58c6, 0x58c6, 0x1bdf, 0x2aaf, 0x2aaf, 0x2aaf, 0x9def, 0x9eef, 0xdbd6, 0x9def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x2aaf, 0xdad6, 0xdbd6, 0xbeef, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xdad6, 0x7de7, 0x2aaf, 0xdad6, 0x9eef, 0xbeef, 0xbeef, 0xfbde, 0x9eef, 0x7de7, 0x3ce7, 0x1cdf, 0x1cdf, 0x247a, 
-	0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x79ce, 0x9ace, 0xbace, 0x2aaf, 0x2aaf, 0xbad6, 0x18be, 0xdbd6, 0xdbd6, 0x38c6, 0x38c6, 0xdbd6, 0xfbde, 0xfbde, 0x79c6, 0x79ce, 0x1cdf, 0x1cdf, 0x1bdf, 0x1cdf, 0x3cdf, 0x2aaf, 0x2aaf, 0x2aaf, 0xdbd6, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x2aaf, 0x7def, 0xdad6, 0x9eef, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbde, 0x9eef, 0xdad6, 0xbad6, 0x2aaf, 0xdad6, 0xdbd6, 0xbef7, 0xfbde, 0xbef7, 0xfbd6, 0x9def, 0x5de7, 0x3ce7, 0x1cdf, 0x3ce7, 
-	0xfbde, 0xbace, 0x2c3d, 0x2c3d, 0x59c6, 0x2aaf, 0x2aaf, 0x9ace, 0x2aaf, 0x2aaf, 0xbad6, 0xdad6, 0x38be, 0xfbd6, 0xfbde, 0x59c6, 0x1bdf, 0x1cdf, 0x3ce7, 0x3ce7, 0x99ce, 0x9ace, 0x5ce7, 0x3ce7, 0x79ce, 0x79ce, 0x79ce, 0x3ce7, 0x2aaf, 0x2aaf, 0x2aaf, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xbeef, 0xdad6, 0x2aaf, 0x7de7, 0x7def, 0xdbd6, 0xfbde, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0xdad6, 0x2aaf, 0xdbd6, 0xbeef, 0xbef7, 0xbef7, 0xfbde, 0xbeef, 0xdbd6, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 
-	0xfbde, 0xbad6, 0x2c3d, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x2aaf, 0x38be, 0xdbd6, 0xfbd6, 0x58c6, 0x1cdf, 0x3ce7, 0x99ce, 0x9ace, 0x5de7, 0xbace, 0xbad6, 0xdad6, 0xbad6, 0xbad6, 0x9ace, 0x99ce, 0x3cdf, 0x1cdf, 0x79ce, 0x2aaf, 0x5de7, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0x29d4, 0x29d4, 0xa8c3, 0x2aaf, 0x2aaf, 0xaaec, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x699e, 0x2aaf, 0x2aaf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x699e, 0x699e, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0x699e, 0x699e, 0x7de7, 0x7def, 0x2aaf, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0xdad6, 0x2aaf, 0x9def, 0xdbd6, 0xfbde, 0xbef7, 0xdef7, 0xfbde, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x5de7, 
-	0x1cdf, 0xdbd6, 0xbace, 0x99ce, 0x99ce, 0x9ace, 0xbad6, 0xdbd6, 0x38c6, 0x58c6, 0xfbde, 0x1cdf, 0x79ce, 0x9ace, 0xbad6, 0xdad6, 0xdad6, 0xdbd6, 0xdbd6, 0xdbd6, 0xfbd6, 0xdbd6, 0xdbd6, 0xdad6, 0x5de7, 0x99ce, 0x3cdf, 0x79ce, 0x2aaf, 0x3ce7, 0x5de7, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0x2aaf, 0x699e, 0x699e, 0x2aaf, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x247a, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0x247a, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0x2aaf, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0x247a, 0x2aaf, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0x2aaf, 0x247a, 0xaaec, 0xaaec, 0x2aaf, 0x2aaf, 0x247a, 0xaaec, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0xdbd6, 0xbeef, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x9def, 0x7def, 0x7def, 
-	0x3ce7, 0x1bdf, 0xdbd6, 0x18be, 0xbad6, 0xdad6, 0xdbd6, 0x38c6, 0x59c6, 0x79c6, 0x3ce7, 0x5ce7, 0x7de7, 0x7def, 0x9eef, 0xbeef, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xdbd6, 0x9def, 0x5de7, 0x3ce7, 0x79ce, 0x1cdf, 0x2aaf, 0x2aaf, 0x5de7, 0x7de7, 0x9def, 0x2aaf, 0xbeef, 0xbeef, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0x2aaf, 0x2aaf, 0xbeef, 0x9eef, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0x2aaf, 0x2aaf, 0xbeef, 0xbeef, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xa8c3, 0x7def, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xaaec, 0xa8c3, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x7def, 0x2aaf, 0x7def, 0xdbd6, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 
-	0x7de7, 0x3ce7, 0x59c6, 0x58c6, 0x58c6, 0xfbde, 0x59c6, 0x79c6, 0x79ce, 0x99ce, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0x7def, 0x5de7, 0x79ce, 0x1cdf, 0x1cdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x2aaf, 0x7de7, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0x7de7, 0x7de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x5ce7, 0x5ce7, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0x247a, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 
-	0x9def, 0x7de7, 0x5ce7, 0x99ce, 0x79ce, 0x79ce, 0x99ce, 0x99ce, 0x9ace, 0xbace, 0x7def, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0xdbd6, 0xbad6, 0x5ce7, 0x3ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0x3cdf, 0x2aaf, 0x5ce7, 0x7de7, 0x7def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x2c3d, 0x2c3d, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x7de7, 0x2c3d, 0x2c3d, 0x9eef, 0x9eef, 0x9def, 0x7def, 0x5de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xfbde, 0xfbde, 0xfbde, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x29d4, 0xaaec, 0xaaec, 0x3cdf, 0x1cdf, 0x1bdf, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x1bdf, 0x1bdf, 0x2aaf, 0x3cdf, 0x3ce7, 0x3ce7, 0x3ce7, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0x5ce7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x5de7, 0x2aaf, 0x7def, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 
-	0xbeef, 0x9def, 0x7def, 0x7def, 0xbad6, 0xbad6, 0xbad6, 0x7de7, 0x7def, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xfbde, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x3ce7, 0x5ce7, 0x2c3d, 0x2c3d, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x3ce7, 0x1cdf, 0x1bdf, 0x1bdf, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7def, 0x7de7, 0x5de7, 0x3ce7, 0x1bdf, 0xfbd6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0x2aaf, 0x247a, 0xdbd6, 0xfbd6, 0xa8c3, 0xa8c3, 0xa8c3, 0x47b3, 0xa8c3, 0x47b3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xfbd6, 0xdbd6, 0xdbd6, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xfbd6, 0xfbde, 0xfbd6, 0xdbd6, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x2aaf, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0xa8c3, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0xa8c3, 0x2aaf, 0x247a, 0xfbde, 0x3cdf, 0x5de7, 0x9def, 0xbeef, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x5ce7, 0x2aaf, 0x5ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xbef7, 0xbeef, 0xbeef, 0x9eef, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xbeef, 0xbeef, 0xbef7, 0xfbde, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xfbde, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x3cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0x1bdf, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 0x5de7, 0x5de7, 0x5ce7, 0x3cdf, 0xfbde, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0x247a, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x47b3, 0xa8c3, 0x47b3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x99ce, 0x79ce, 0x2aaf, 0x247a, 0x2aaf, 0x247a, 0xaaec, 0x1cdf, 0x5de7, 0x9def, 0x9eef, 0x9eef, 0x7def, 0x5de7, 0x3ce7, 0x3cdf, 0x2aaf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xbef7, 0xbeef, 0x7def, 0x5de7, 0x3ce7, 0x1bdf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x7def, 0x7def, 0x9def, 0x9def, 0x9def, 0x9def, 0x7de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x1cdf, 0x1cdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x2c3d, 0x2c3d, 0x5ce7, 0x5de7, 0x5ce7, 0x3cdf, 0xfbde, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x99ce, 0x9ace, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0xe469, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x247a, 0x2aaf, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0x9ace, 0x9ace, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0x247a, 0x2aaf, 0xbace, 0xbace, 0x247a, 0x247a, 0x247a, 0x247a, 0x79c6, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x79ce, 0x79ce, 0x2aaf, 0x79c6, 0x79ce, 0x2aaf, 0x247a, 0x247a, 0x1bdf, 0x5de7, 0x9def, 0x9eef, 0x9def, 0x7de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x2aaf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0x1bdf, 0xfbde, 0xfbde, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x5ce7, 0x7de7, 0x7def, 0x9def, 0x9eef, 0xbeef, 0x9eef, 0x9def, 0x7de7, 0x2c3d, 0x3ce7, 0x1cdf, 0x1cdf, 0x1cdf, 0x3cdf, 0x3ce7, 0x3cdf, 0x1cdf, 0x1bdf, 0xfbde, 0x1bdf, 0x2c3d, 0x5ce7, 0x5de7, 0x5de7, 0x3ce7, 0xfbde, 0xdad6, 0x99ce, 0x79ce, 0x59c6, 0x58c6, 0x58c6, 0x59c6, 0x59c6, 0x2aaf, 0x2aaf, 0x99ce, 0x2aaf, 0x2aaf, 0x79ce, 0x2aaf, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x99ce, 0x9ace, 0xf7bd, 0xbace, 0x9ace, 0x99ce, 0x79ce, 0x79c6, 0x59c6, 0x2aaf, 0x79c6, 0x79ce, 0x2aaf, 0x99ce, 0x99ce, 0x2aaf, 0x79ce, 0x79c6, 0x59c6, 0x2aaf, 0x59c6, 0x79c6, 0x247a, 0x247a, 0xaaec, 0xaaec, 0xa8c3, 0x247a, 0x247a, 0x79ce, 0x79ce, 0x99ce, 0x2aaf, 0x2aaf, 0x9ace, 0x99ce, 0x2aaf, 0x79ce, 0x79c6, 0x79c6, 0x79c6, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x79ce, 0x79ce, 0x79ce, 0x2aaf, 0xbace, 0xdbd6, 0x1cdf, 0x5de7, 0xdbd6, 0xdbd6, 0xdbd6, 0x7de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x2aaf, 0x3ce7, 0x7de7, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0xfbde, 0xfbd6, 0xdbd6, 0x2aaf, 0xfbde, 0x1bdf, 0x1cdf, 0x3ce7, 0x7de7, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x1cdf, 0x1cdf, 0x1cdf, 0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x3ce7, 0x1cdf, 0x1bdf, 0x1bdf, 0x1cdf, 0x5ce7, 0x7de7, 0x7de7, 0x5ce7, 0x1cdf, 0xdbd6, 0xbace, 0x99ce, 0x79ce, 0x79c6, 0x79c6, 0x79c6, 0x79ce, 0x79ce, 0x2aaf, 0x2aaf, 0x2aaf, 0x99ce, 0x79ce, 0x2aaf, 0x79ce, 0x79ce, 0x99ce, 0x99ce, 0x99ce, 0xf7b5, 0xf7b5, 0xf7bd, 0x9ace, 0xf7bd, 0xbace, 0x9ace, 0x9ace, 0x79ce, 0x79ce, 0x79c6, 0x79c6, 0x2aaf, 0x2aaf, 0x99ce, 0x99ce, 0x99ce, 0x2aaf, 0x79ce, 0x79ce, 0x79c6, 0x59c6, 0x2aaf, 0x79c6, 0x79ce, 0x2aaf, 0x247a, 0x247a, 0x247a, 0x99ce, 0x79ce, 0x99ce, 0x99ce, 0x9ace, 0x9ace, 0x2aaf, 0x2aaf, 0x2aaf, 0x99ce, 0x79ce, 0xd7b5, 0xf7b5, 0x99ce, 0x99ce, 0x99ce, 0x99ce, 0x9ace, 0x9ace, 0x9ace, 0x99ce, 0x99ce, 0x2aaf, 0xbad6, 0xfbde, 0x3ce7, 0xbad6, 0xdbd6, 0xfbd6, 0xdbd6, 0xbad6, 0x9ace, 0x3ce7, 0x3cdf, 0x3ce7, 0x2aaf, 0xbad6, 0xdbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xfbde, 0xdbd6, 0xbace, 0x79ce, 0x1bdf, 0xfbde, 0xdbd6, 0x2aaf, 0xdbd6, 0xfbde, 0x1bdf, 0x3ce7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x3cdf, 0x1cdf, 0x3ce7, 0x5de7, 0x7def, 0x9def, 0x7def, 0x7de7, 0x5ce7, 0x3cdf, 0x1cdf, 0x3ce7, 0x5de7, 0x7def, 0x7def, 0x7de7, 0x3ce7, 0x1bdf, 0xdbd6, 0xbad6, 0xbace, 0x9ace, 0x9ace, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0x9ace, 0x9ace, 0x9ace, 0x2aaf, 0x9ace, 0x9ace, 0xbace, 0xbace, 0xbace, 0x17be, 0xbace, 0xbace, 0x17be, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbace, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x9ace, 0x9ace, 0xbace, 0x2aaf, 0xbace, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x79ce, 0x2aaf, 0x2aaf, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0x9ace, 0xbace, 0xbace, 0xbace, 0xbad6, 0xbace, 0xbace, 0xbace, 0xf7bd, 0xbace, 0xbad6, 0x18be, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0xdad6, 0x18be, 0x699e, 0x18be, 0xdbd6, 0x1bdf, 0x9ace, 0xdad6, 0xbeef, 0xbeef, 0xbeef, 0x9def, 0x7de7, 0x9ace, 0x5ce7, 0x99ce, 0x699e, 0xdad6, 0xdbd6, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xfbde, 0xbef7, 0x9eef, 0xdad6, 0x9ace, 0x79ce, 0x1bdf, 0xfbd6, 0x2aaf, 0xdbd6, 0xfbde, 0x1bdf, 0x3ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x3ce7, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0x9eef, 0x9eef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x5ce7, 0xbace, 0x9def, 0x9eef, 0x9def, 0x7de7, 0x3ce7, 0x1bdf, 0xfbde, 0xdbd6, 0xdbd6, 0x38be, 0x38be, 0x38be, 0x18be, 0x18be, 0x17be, 0xbad6, 0xbad6, 0x2aaf, 0xbad6, 0xdad6, 0xdbd6, 0xdbd6, 0xfbd6, 0x38c6, 0xdbd6, 0xdbd6, 0x38c6, 0xfbd6, 0xfbd6, 0xfbd6, 0xfbd6, 0xfbd6, 0xdbd6, 0x38be, 0x18be, 0x18be, 0x18be, 0xbad6, 0xdad6, 0xdad6, 0x2aaf, 0xdad6, 0xdad6, 0xdad6, 0xbad6, 0xbad6, 0xbace, 0xbace, 0xbace, 0xbace, 0xbad6, 0xbad6, 0x17be, 0x17be, 0x18be, 0xdad6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0x38c6, 0xfbde, 0xfbde, 0x59c6, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x58c6, 0xfbde, 0x2aaf, 0xfbde, 0x59c6, 0x3ce7, 0xbace, 0x9def, 0xbeef, 0xfbde, 0xbef7, 0xfbd6, 0x9def, 0xbad6, 0x7de7, 0x5de7, 0x699e, 0x9def, 0xbeef, 0xfbde, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xbef7, 0xfbde, 0x9eef, 0xdad6, 0x9ace, 0x3ce7, 0x59c6, 0x699e, 0x58c6, 0x1bdf, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdbd6, 0x9def, 0x7de7, 0x5de7, 0x7de7, 0x7def, 0xdbd6, 0xfbd6, 0xfbde, 0xbef7, 0xbeef, 0x9def, 0x7def, 0x7de7, 0xbad6, 0x9def, 0xdbd6, 0xbeef, 0x9eef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x79ce, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0x38c6, 0xdbd6, 0x38c6, 0x699e, 0x38c6, 0xfbde, 0x1cdf, 0x3cdf, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x3ce7, 0x3ce7, 0x3ce7, 0x3cdf, 0x79ce, 0x79c6, 0x59c6, 0x58c6, 0x58c6, 0x58c6, 0xfbde, 0x58c6, 0x2aaf, 0x58c6, 0x58c6, 0xfbde, 0xfbde, 0xfbde, 0xfbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0x38c6, 0xdbd6, 0xfbd6, 0xfbde, 0x58c6, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0x59c6, 0x59c6, 0x79ce, 0x3ce7, 0x99ce, 0x5de7, 0x5de7, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x79ce, 0x3ce7, 0x699e, 0x3cdf, 0x79ce, 0x5de7, 0xdad6, 0xbeef, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0xbeef, 0xdbd6, 0x7def, 0x7de7, 0x2aaf, 0x9def, 0xbeef, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0xdbd6, 0xdad6, 0xbace, 0x3ce7, 0x699e, 0x3cdf, 0x79ce, 0x5ce7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0xdbd6, 0x9def, 0x9def, 0x9def, 0xdbd6, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0xdbd6, 0x9eef, 0xfbde, 0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x7de7, 0xbad6, 0x7de7, 0x5de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x79ce, 0x59c6, 0x59c6, 0x2aaf, 0x1cdf, 0x79ce, 0x5ce7, 0x5de7, 0x7de7, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0x7de7, 0x7de7, 0xbad6, 0xbace, 0xbace, 0x5ce7, 0x99ce, 0x3ce7, 0x79ce, 0x3cdf, 0x79ce, 0x699e, 0x3ce7, 0x3ce7, 0x99ce, 0x3ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0x1bdf, 0xfbde, 0xfbde, 0x59c6, 0x1cdf, 0x3cdf, 0x3ce7, 0x99ce, 0x9ace, 0x99ce, 0x99ce, 0x99ce, 0x79ce, 0x99ce, 0x9ace, 0xbace, 0x7de7, 0xdad6, 0x9def, 0x9def, 0x9def, 0x7def, 0x7def, 0x7de7, 0xbace, 0x5de7, 0x2aaf, 0x9ace, 0xbace, 0xdad6, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xfbde, 0x9eef, 0x9def, 0x7def, 0x2aaf, 0x9def, 0x9eef, 0xbef7, 0xfbde, 0x1bdf, 0x1bdf, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xfbde, 0x9eef, 0xdad6, 0xbace, 0x2aaf, 0x5ce7, 0xbace, 0x7def, 0x9eef, 0xbeef, 0xfbde, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbef7, 0xbeef, 0xfbde, 0xbeef, 0xfbde, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbef7, 0xbef7, 0xfbde, 0xbeef, 0xbef7, 0xfbde, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xdbd6, 0xdbd6, 0x9eef, 0xdbd6, 0x9def, 0xbad6, 0x7de7, 0x9ace, 0x3ce7, 0x79ce, 0x2aaf, 0x5ce7, 0xbace, 0x7def, 0x9def, 0x9eef, 0xdbd6, 0x9eef, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0xdbd6, 0x9eef, 0xdbd6, 0xdbd6, 0x9eef, 0x9def, 0x7def, 0xbad6, 0xbace, 0x9ace, 0x9ace, 0x2aaf, 0x5de7, 0xbace, 0x7de7, 0x7def, 0x7de7, 0x5de7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5ce7, 0x9ace, 0x5de7, 0xbad6, 0xdad6, 0xdad6, 0xdad6, 0x7def, 0x7de7, 0x7de7, 0xbad6, 0xdad6, 0xdbd6, 0xdbd6, 0xfbd6, 0xbeef, 0xbeef, 0xbeef, 0xfbd6, 0x9eef, 0x9def, 0x7def, 0xbad6, 0x2aaf, 0x7de7, 0xdad6, 0xdbd6, 0xbeef, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xfbd6, 0xdbd6, 0x699e, 0xdad6, 0x9def, 0x9eef, 0xbeef, 0xbef7, 0xfbde, 0xfbde, 0xbeef, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xfbd6, 0xdbd6, 0x7def, 0x7de7, 0x699e, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0xbef7, 0xfbde, 0xfbd6, 0xdbd6, 0x9def, 0xdad6, 0xbace, 0xbace, 0x2aaf, 0x7de7, 0xdad6, 0x9eef, 0xbeef, 0xbef7, 0xfbde, 0xfbde, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0xbeef, 0xbeef, 0x9eef, 0x9def, 0x7def, 0xbad6, 0x7de7, 0x2aaf, 0xdad6, 0x9def, 0x9eef, 0x9eef, 0x9def, 0x7def, 0x7def, 0x7def, 0x7def, 0xdad6, 0x9def, 0x9eef, 0xdbd6, 0xfbd6, 0xfbd6, 0xbeef, 0xdbd6, 0xdbd6, 0xdbd6, 0x9eef, 0xfbd6, 0xfbde, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xbeef, 0x9def, 0xdad6, 0x7def, 0x2aaf, 0xdbd6, 0xfbd6, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbd6, 0x9def, 0x699e, 0x7def, 0xdad6, 0x9eef, 0xbeef, 0xbef7, 0xfbde, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbeef, 0xdbd6, 0xdad6, 0xbad6, 0x2aaf, 0xdbd6, 0xbeef, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0xdad6, 0x7def, 0xbad6, 0x699e, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0xdbd6, 0xdad6, 0xbad6, 0x2aaf, 0xdbd6, 0x9eef, 0xbeef, 0xbeef, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0xbeef, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0xfbde, 0xbef7, 0xfbde, 0xbef7, 0xfbde, 0xbef7, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0x9eef, 0x9def, 0xbad6, 0x699e, 0xdbd6, 0xfbd6, 0xfbde, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0x699e, 0x7def, 0xdad6, 0x9eef, 0xbeef, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbeef, 0xdbd6, 0xdad6, 0x7def, 0x2aaf, 0xdbd6, 0xbeef, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0xdad6, 0x7def, 0x2aaf, 0xdbd6, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbeef, 0xdbd6, 0xdad6, 0xbad6, 0x699e, 0xdbd6, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbeef, 0xdbd6, 0x9def, 0x7def, 0x2aaf, 0xdbd6, 0xfbd6, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbd6, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbeef, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xfbde, 0xdbd6, 0xdad6, 0x7def, 0x2aaf, 0xdbd6, 0xbeef, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0x9eef, 0xdad6, 0x7def, 0x2aaf, 0xdbd6, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xfbde, 0xdbd6, 0xdad6, 0xdad6, 0x2aaf, 0xdbd6, 0xbeef, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xbef7, 0xfbde, 0xdbd6, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xdad6, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0x9eef, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0xdad6, 0x699e, 0x9def, 0x9eef, 0xbef7, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xbef7, 0xdbd6, 0xdad6, 0x7def, 0x699e, 0xdbd6, 0xbeef, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0xdad6, 0x2aaf, 0xdad6, 0x9eef, 0xbef7, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbeef, 0xdbd6, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9eef, 0x7def, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x9def, 0x9def, 0x7de7, 0x3ce7, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0xab34, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbd6, 0xdbd6, 0xdad6, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0xbad6, 0x5de7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0xdbd6, 0xbad6, 0x5ce7, 0x5ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x7de7, 0x5ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9def, 0x7def, 0x2c3d, 0xab34, 0xab34, 0xab34, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xbef7, 0xfbde, 0x9def, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x5ce7, 0x9ace, 0xbad6, 0x9def, 0xbeef, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0xdbd6, 0x7de7, 0x99ce, 0x79ce, 0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9def, 0x7de7, 0x5de7, 0x2c3d, 0xab34, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0xdbd6, 0x7de7, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xfbde, 0xdbd6, 0xbad6, 0xbace, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x5ce7, 0x3ce7, 0x99ce, 0x9ace, 0xdad6, 0x9eef, 0xbef7, 0xfbde, 0xfbde, 0xfbde, 0x9eef, 0x7de7, 0x5ce7, 0x79ce, 0x3ce7, 0x3ce7, 0x5ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0xdbd6, 0x7de7, 0x5ce7, 0x5ce7, 0x5de7, 0x7de7, 0x9def, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xbace, 0x5ce7, 0x99ce, 0x5de7, 0x7de7, 0x9def, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xbace, 0x5ce7, 0x99ce, 0x5de7, 0x7de7, 0x9def, 0xfbd6, 0xfbde, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7de7, 0x5ce7, 0x79ce, 0x79ce, 0x9ace, 0xbad6, 0xdbd6, 0xfbde, 0xfbde, 0xfbde, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x99ce, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xbace, 0x99ce, 0x79ce, 0x3ce7, 0x5de7, 0x7def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0xdbd6, 0xbace, 0x5ce7, 0x79ce, 0x3ce7, 0x5de7, 0xdad6, 0xdbd6, 0xfbde, 0xfbde, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xbace, 0x99ce, 0x79ce, 0x3ce7, 0x5de7, 0xdad6, 0xdbd6, 0xfbde, 0xfbde, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5de7, 0x99ce, 0x99ce, 0x9ace, 0xbad6, 0x9eef, 0xfbde, 0xfbde, 0x1bdf, 0xbef7, 0xfbde, 0xdbd6, 0xbad6, 0x5de7, 0x5ce7, 0x5ce7, 0x3ce7, 0x2c3d, 0x2c3d, 0xdbd6, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0x7de7, 0x5ce7, 0x79ce, 0x3ce7, 0x5ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0xdbd6, 0x7de7, 0x5ce7, 0x79ce, 0x3ce7, 0x9ace, 0xbad6, 0xdbd6, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xbad6, 0x5ce7, 0x3ce7, 0x79ce, 0x5ce7, 0x7de7, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7de7, 0xbace, 0xbad6, 0xdad6, 0xdbd6, 0xbef7, 0xbef7, 0x1bdf, 0x1bdf, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x7de7, 0x5de7, 0x5ce7, 0x2c3d, 0xfbde, 0xdad6, 0x9ace, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xdbd6, 0x7def, 0xbace, 0x5ce7, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xdbd6, 0x7def, 0xbace, 0x5ce7, 0x5ce7, 0x5de7, 0xbad6, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xdbd6, 0x7def, 0x5de7, 0x99ce, 0x5ce7, 0x5de7, 0x7def, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0xdbd6, 0xdbd6, 0xfbde, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9eef, 0x9def, 0x7def, 0x5de7, 0x3ce7, 0xfbde, 0xdad6, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0xdbd6, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0xdbd6, 0x7def, 0x7de7, 0x7de7, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9eef, 0xdad6, 0x7de7, 0x7de7, 0x7de7, 0x9def, 0x9eef, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xfbde, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0x9def, 0x7de7, 0x3ce7, 0xfbde, 0xdad6, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0x9eef, 0x9eef, 0x9def, 0x9eef, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xfbde, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0xbeef, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xfbde, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0xab34, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9eef, 0x2c3d, 0x3ce7, 0xfbde, 0x38be, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0xdbd6, 0xab34, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0xdef7, 0xdef7, 0x2c3d, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0xab34, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0xbef7, 0x2c3d, 0x2c3d, 0xbef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0xab34, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0xfbde, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3cdf, 0xfbde, 0xab34, 0x99ce, 0xab34, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0x38be, 0x9ace, 0xd6b5, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdbd6, 0xfbde, 0x2c3d, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbeef, 0x9def, 0x5de7, 0x3ce7, 0x38c6, 0xbad6, 0xab34, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xdad6, 0x2c3d, 0x2c3d, 0xfbde, 0xfbde, 0x2c3d, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xbef7, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0xab34, 0x79ce, 0x79ce, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xfbd6, 0x2c3d, 0x2c3d, 0xfbde, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9eef, 0x7de7, 0x3ce7, 0xfbde, 0x18be, 0x9ace, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xbeef, 0x9def, 0x5de7, 0x1cdf, 0x38c6, 0xbad6, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xab34, 0x2c3d, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x2c3d, 0x2c3d, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbef7, 0x9eef, 0x7def, 0x5ce7, 0x1bdf, 0xdbd6, 0xdad6, 0x2c3d, 0x2c3d, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xfbde, 0xbef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x2c3d, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xbeef, 0x9def, 0x7de7, 0x3ce7, 0xfbde, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x7de7, 0x9def, 0x2c3d, 0xbef7, 0xfbde, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xbeef, 0x2c3d, 0x2c3d, 0x2c3d, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xfbde, 0xbeef, 0x7def, 0x5ce7, 0x1cdf, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0xab34, 0x2c3d, 0xfbd6, 0x2c3d, 0xab34, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xbef7, 0xbef7, 0x2c3d, 0x2c3d, 0x2c3d, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbd6, 0x9eef, 0x9def, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xbef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xfbde, 0x9def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 
-	0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0xab34, 0xab34, 0xab34, 0xab34, 0xfbde, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x29d4, 0x29d4, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xbeef, 0x9eef, 0x9eef, 0x2c3d, 0x9eef, 0x9eef, 0xfbde, 0xbef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xbef7, 0xbef7, 0x9eef, 0xdad6, 0x7de7, 0x5de7, 0x2c3d, 0x7def, 0x9eef, 0xbef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xfbde, 0xfbde, 0x9eef, 0xab34, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x9eef, 0xbeef, 0xfbde, 0xfbde, 0xbef7, 0xbef7, 0xaaec, 0xa8c3, 0xa8c3, 0x29d4, 0x29d4, 0xfbde, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0x9eef, 0x9def, 0x2aaf, 0x2aaf, 0x2aaf, 0xdad6, 0xdbd6, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0xfbde, 0xfbde, 0xdbd6, 0xbad6, 0x5ce7, 0x2aaf, 0x2aaf, 0x2aaf, 0x9def, 0xfbde, 0xfbde, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0x699e, 0x699e, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0x1bdf, 0xdef7, 0xdef7, 0x2aaf, 0x2aaf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0x1bdf, 0xdef7, 0xfbde, 0xfbd6, 0xdad6, 0x5de7, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 
-	0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x247a, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0x2aaf, 0x2aaf, 0x2aaf, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x2aaf, 0x2aaf, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0x2aaf, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xbef7, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0x247a, 0x247a, 0x2aaf, 0xaaec, 0xaaec, 0xbef7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x247a, 0x2aaf, 0x29d4, 0xfbde, 0xfbde, 0xfbde, 0x29d4, 0x29d4, 0x29d4, 0xbeef, 0x9eef, 0x7def, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x247a, 0x247a, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7de7, 0x7de7, 0x7de7, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xbeef, 0xbeef, 0xbeef, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xbeef, 0xbeef, 0xbeef, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xbeef, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x247a, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2aaf, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0x5ce7, 0x5de7, 0x7de7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0x9def, 0x9def, 0x9def, 0x7def, 0x7def, 0x9def, 0xa8c3, 0xa8c3, 0xa8c3, 0x7de7, 0x5ce7, 0x1cdf, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0xa8c3, 0xa8c3, 0x7de7, 0x7def, 0x7def, 0x7def, 0x9def, 0xa8c3, 0xa8c3, 0xa8c3, 0x9def, 0x7def, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0x9def, 0x9def, 0x9def, 0x9def, 0x9def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x7def, 0xa8c3, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0x7def, 0x7def, 0xa8c3, 0xa8c3, 0x7de7, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0x9def, 0x9def, 0x9def, 0x9def, 0x7def, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2aaf, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0x1cdf, 0x1bdf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0x2aaf, 0xa8c3, 0x5ce7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x5ce7, 0x5ce7, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x5ce7, 0x3ce7, 0x1cdf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x3ce7, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x5ce7, 0x5ce7, 0x3ce7, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0x5ce7, 0x5ce7, 0x5ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0x5de7, 0x5ce7, 0x3ce7, 0x3cdf, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x3ce7, 0xa8c3, 0xa8c3, 0xaaec, 0x3ce7, 0x5ce7, 0x5ce7, 0xaaec, 0xa8c3, 0xa8c3, 0x3cdf, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2c3d, 0x2c3d, 0x247a, 
-	0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x2c3d, 0x247a, 0xa8c3, 0xa8c3, 0xaaec, 0xdbd6, 0xdad6, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x2aaf, 0x247a, 0xa8c3, 0x247a, 0x247a, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xfbde, 0xfbde, 0xa8c3, 0xa8c3, 0xaaec, 0xaaec, 0xaaec, 0xa8c3, 0x1bdf, 0xfbde, 0xaaec, 0xa8c3, 0xa8c3, 0x247a, 0x2aaf, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0xa8c3, 0x247a, 0x247a, 0xa8c3
+constexpr uint16_t BOOT_ROWS[] = {
+	    0,     0,     0,     3,    55,   107,   151,   189,
+	  236,   262,   289,   314,   346,   372,   426,   488,
+	  560,   626,   693,   737,   786,   852,   915,   978,
+	 1048,  1129,  1209,  1281,  1357,  1420,  1487,  1551,
+	 1593,  1644,  1696,  1739,  1784,  1835,  1892,  1969,
+	 2051,  2141,  2200,  2254,  2321,  2385,  2438,  2510,
+	 2600,  2671,  2758,  2843,  2919,  2984,  3061,  3142,
+	 3220,  3290,  3372,  3467,  3562,  3655,  3741,  3831,
+	 3921,  4015,  4097,  4193,  4290,  4383,  4468,  4547,
+	 4633,  4711,  4813,  4905,  4934,  4959,  4983,  5008,
+	 5030,  5058,  5087,  5125,  5173,  5234,  5310,  5409,
+	 5507,  5620,  5737,  5849,  5957,  6070,  6181,  6298,
+	 6411,  6509,  6612,  6724,  6827,  6919,  6987,  7043,
+	 7088,  7149,  7237,  7344,  7453,  7570,  7662,  7766,
+	 7891,  8014,  8132,  8253,  8368,  8487,  8599,  8696,
+	 8775,  8849,  8957,  9062,  9071,  9071,  9071,  9071,
+	 9071,
 };
 
-constexpr uint16_t SPRITESHEET_COLORMAP[] = {
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0x40fc, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0x40fc, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0x40fc, 0x40fc, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0x60fe, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0x60fe, 0x60fe, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0x40fc, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0x40fc, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x40fc, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0x60fe, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0x60fe, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x60fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xe0fe, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe0fe, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0x1f00, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xe007, 0xe007, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xe007, 0xe007, 0xdef7, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xe007, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0x1f00, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x3f8a, 0x3f8a, 0x3f8a, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xe007, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x0000, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 
-	0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7
+constexpr uint8_t BOOT_DELTA[] = {
+	0x2f, 0x01, 0x17, 0x04, 0x0b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x03, 0x0b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x04, 0x17,
+	0x13, 0x13, 0x11, 0x29, 0x08, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x03, 0x05, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x04, 0x01, 0x17, 0x03, 0x0c, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x0c, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x16, 0x01, 0x1d, 0x27, 0x01, 0x17, 0x03, 0x0b, 0x17, 0x00, 0x17, 0x00, 0x17,
+	0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x05, 0x03, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x04, 0x01,
+	0x17, 0x04, 0x01, 0x17, 0x05, 0x01, 0x17, 0x04, 0x01, 0x17, 0x04, 0x01, 0x17, 0x16, 0x01, 0x1d,
+	0x27, 0x10, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00,
+	0x17, 0x17, 0x04, 0x03, 0x17, 0x17, 0x17, 0x03, 0x01, 0x17, 0x04, 0x01, 0x17, 0x0f, 0x01, 0x17,
+	0x04, 0x01, 0x17, 0x15, 0x03, 0x11, 0x12, 0x1e, 0x26, 0x09, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00,
+	0x17, 0x00, 0x17, 0x03, 0x03, 0x17, 0x00, 0x17, 0x05, 0x03, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17,
+	0x04, 0x01, 0x17, 0x04, 0x01, 0x21, 0x05, 0x01, 0x21, 0x04, 0x01, 0x17, 0x04, 0x01, 0x17, 0x13,
+	0x05, 0x17, 0x13, 0x04, 0x06, 0x0e, 0x27, 0x08, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17,
+	0x03, 0x05, 0x17, 0x00, 0x17, 0x17, 0x17, 0x03, 0x03, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x04,
+	0x01, 0x17, 0x04, 0x01, 0x21, 0x05, 0x01, 0x21, 0x04, 0x01, 0x17, 0x04, 0x01, 0x17, 0x11, 0x06,
+	0x17, 0x17, 0x17, 0x03, 0x03, 0x11, 0x03, 0x01, 0x17, 0x04, 0x01, 0x17, 0x0f, 0x01, 0x17, 0x04,
+	0x01, 0x17, 0x10, 0x07, 0x17, 0x00, 0x00, 0x17, 0x17, 0x03, 0x1f, 0x06, 0x01, 0x22, 0x05, 0x01,
+	0x23, 0x03, 0x01, 0x17, 0x04, 0x01, 0x13, 0x0f, 0x01, 0x13, 0x04, 0x01, 0x17, 0x0f, 0x01, 0x17,
+	0x04, 0x02, 0x17, 0x13, 0x07, 0x01, 0x24, 0x06, 0x01, 0x22, 0x03, 0x01, 0x17, 0x04, 0x01, 0x13,
+	0x0f, 0x01, 0x13, 0x04, 0x01, 0x17, 0x0e, 0x03, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x05, 0x07,
+	0x15, 0x12, 0x1e, 0x25, 0x01, 0x01, 0x24, 0x04, 0x01, 0x26, 0x03, 0x01, 0x17, 0x19, 0x01, 0x17,
+	0x0e, 0x06, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x05, 0x01, 0x1a, 0x03, 0x04, 0x27, 0x0e, 0x1e,
+	0x26, 0x05, 0x01, 0x28, 0x03, 0x01, 0x17, 0x04, 0x01, 0x21, 0x0f, 0x01, 0x21, 0x04, 0x01, 0x17,
+	0x0f, 0x05, 0x17, 0x00, 0x17, 0x17, 0x17, 0x05, 0x01, 0x0e, 0x03, 0x01, 0x15, 0x03, 0x01, 0x15,
+	0x05, 0x03, 0x19, 0x14, 0x15, 0x15, 0x08, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x03,
+	0x05, 0x17, 0x00, 0x17, 0x17, 0x17, 0x03, 0x02, 0x17, 0x17, 0x03, 0x01, 0x17, 0x04, 0x01, 0x21,
+	0x0f, 0x01, 0x21, 0x04, 0x01, 0x17, 0x04, 0x01, 0x17, 0x05, 0x09, 0x17, 0x17, 0x17, 0x00, 0x00,
+	0x17, 0x17, 0x17, 0x17, 0x06, 0x01, 0x12, 0x03, 0x01, 0x18, 0x03, 0x01, 0x18, 0x05, 0x04, 0x1e,
+	0x0a, 0x10, 0x14, 0x13, 0x01, 0x17, 0x03, 0x0b, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17,
+	0x17, 0x00, 0x17, 0x05, 0x03, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x04, 0x01, 0x29, 0x03, 0x01,
+	0x15, 0x07, 0x01, 0x15, 0x03, 0x01, 0x29, 0x04, 0x01, 0x17, 0x03, 0x03, 0x17, 0x00, 0x17, 0x03,
+	0x0a, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x06, 0x01, 0x11, 0x03, 0x01,
+	0x0e, 0x04, 0x01, 0x1d, 0x04, 0x04, 0x12, 0x07, 0x0e, 0x18, 0x13, 0x10, 0x17, 0x00, 0x17, 0x00,
+	0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x04, 0x02, 0x17, 0x17,
+	0x03, 0x01, 0x13, 0x08, 0x09, 0x14, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x14, 0x08, 0x01,
+	0x13, 0x03, 0x03, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x03, 0x06, 0x17, 0x17, 0x00, 0x17, 0x17,
+	0x17, 0x05, 0x01, 0x13, 0x04, 0x01, 0x11, 0x09, 0x04, 0x1f, 0x11, 0x12, 0x1d, 0x13, 0x09, 0x17,
+	0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x03, 0x03, 0x17, 0x00, 0x17, 0x05, 0x03, 0x17,
+	0x00, 0x17, 0x03, 0x01, 0x13, 0x08, 0x02, 0x18, 0x18, 0x06, 0x01, 0x18, 0x08, 0x04, 0x13, 0x03,
+	0x00, 0x17, 0x03, 0x0d, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x05, 0x01, 0x17, 0x04, 0x01, 0x13, 0x04, 0x03, 0x13, 0x13, 0x13, 0x04, 0x02, 0x13, 0x11,
+	0x14, 0x08, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x03, 0x05, 0x17, 0x00, 0x17, 0x17,
+	0x17, 0x03, 0x02, 0x17, 0x17, 0x03, 0x01, 0x1f, 0x08, 0x09, 0x1e, 0x0e, 0x1d, 0x1d, 0x1d, 0x1d,
+	0x1d, 0x0e, 0x1e, 0x08, 0x01, 0x1f, 0x03, 0x10, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x0f, 0x04, 0x17, 0x00, 0x00, 0x17, 0x05, 0x01,
+	0x11, 0x03, 0x01, 0x11, 0x08, 0x03, 0x1d, 0x12, 0x11, 0x03, 0x03, 0x11, 0x12, 0x1d, 0x08, 0x01,
+	0x11, 0x03, 0x05, 0x17, 0x17, 0x17, 0x00, 0x17, 0x06, 0x05, 0x17, 0x17, 0x00, 0x00, 0x17, 0x04,
+	0x02, 0x17, 0x17, 0x04, 0x02, 0x17, 0x17, 0x03, 0x04, 0x17, 0x00, 0x00, 0x17, 0x06, 0x03, 0x11,
+	0x09, 0x18, 0x03, 0x01, 0x11, 0x09, 0x08, 0x11, 0x0c, 0x1f, 0x11, 0x1f, 0x0c, 0x11, 0x11, 0x08,
+	0x12, 0x11, 0x04, 0x03, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00,
+	0x17, 0x17, 0x17, 0x05, 0x03, 0x17, 0x00, 0x17, 0x03, 0x09, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x17, 0x17, 0x08, 0x03, 0x1d, 0x1a, 0x19, 0x34, 0x02, 0x17, 0x17, 0x08, 0x02, 0x17, 0x17,
+	0x08, 0x02, 0x17, 0x17, 0x0e, 0x06, 0x1f, 0x11, 0x05, 0x05, 0x1f, 0x1f, 0x0c, 0x0f, 0x17, 0x00,
+	0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x04, 0x01, 0x17,
+	0x03, 0x07, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x04, 0x01, 0x17, 0x08, 0x03, 0x12, 0x23,
+	0x1b, 0x33, 0x04, 0x17, 0x17, 0x17, 0x17, 0x06, 0x04, 0x17, 0x17, 0x17, 0x17, 0x06, 0x04, 0x17,
+	0x17, 0x17, 0x17, 0x10, 0x02, 0x11, 0x11, 0x0e, 0x10, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x04, 0x04, 0x17, 0x00, 0x00, 0x17, 0x03,
+	0x02, 0x17, 0x17, 0x05, 0x02, 0x17, 0x17, 0x08, 0x01, 0x23, 0x33, 0x06, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x17, 0x04, 0x06, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x04, 0x06, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x17, 0x21, 0x07, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x04, 0x04, 0x17, 0x00, 0x17,
+	0x17, 0x04, 0x03, 0x17, 0x17, 0x17, 0x04, 0x02, 0x17, 0x17, 0x06, 0x01, 0x17, 0x28, 0x01, 0x17,
+	0x03, 0x0b, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x05, 0x07, 0x17,
+	0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x03, 0x07, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x03,
+	0x07, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x03, 0x01, 0x1d, 0x04, 0x01, 0x28, 0x0f, 0x01,
+	0x28, 0x04, 0x04, 0x1d, 0x05, 0x03, 0x17, 0x03, 0x08, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17,
+	0x17, 0x03, 0x01, 0x17, 0x04, 0x02, 0x17, 0x17, 0x06, 0x01, 0x17, 0x06, 0x03, 0x13, 0x13, 0x1f,
+	0x26, 0x09, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x06, 0x01,
+	0x17, 0x03, 0x07, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x03, 0x07, 0x17, 0x17, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x03, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x01, 0x1d, 0x04, 0x01, 0x2a, 0x0f,
+	0x01, 0x2a, 0x04, 0x04, 0x1d, 0x05, 0x03, 0x17, 0x03, 0x06, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x05, 0x01, 0x17, 0x04, 0x01, 0x17, 0x07, 0x01, 0x17, 0x06, 0x03, 0x23, 0x23, 0x23, 0x26, 0x0a,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x03, 0x01, 0x17, 0x04, 0x01, 0x17,
+	0x03, 0x07, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x03, 0x07, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x00, 0x17, 0x03, 0x05, 0x17, 0x17, 0x00, 0x00, 0x17, 0x03, 0x01, 0x1d, 0x04, 0x01, 0x28, 0x0f,
+	0x01, 0x28, 0x04, 0x01, 0x1d, 0x03, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x01, 0x17, 0x04, 0x03,
+	0x17, 0x17, 0x17, 0x03, 0x01, 0x17, 0x07, 0x01, 0x17, 0x07, 0x02, 0x23, 0x23, 0x26, 0x01, 0x17,
+	0x03, 0x03, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x03, 0x01, 0x17, 0x03, 0x01, 0x17, 0x05, 0x05,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x05, 0x05, 0x17, 0x00, 0x17, 0x00, 0x17, 0x05, 0x03, 0x17, 0x00,
+	0x17, 0x03, 0x01, 0x12, 0x04, 0x01, 0x15, 0x0f, 0x01, 0x15, 0x04, 0x01, 0x12, 0x0a, 0x02, 0x17,
+	0x17, 0x04, 0x08, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x06, 0x02, 0x17, 0x13, 0x06,
+	0x01, 0x2b, 0x27, 0x01, 0x17, 0x03, 0x0a, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x04, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x07, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17,
+	0x03, 0x07, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x03, 0x02, 0x17, 0x17, 0x03, 0x01, 0x12,
+	0x04, 0x01, 0x19, 0x0f, 0x01, 0x19, 0x04, 0x01, 0x12, 0x09, 0x03, 0x17, 0x17, 0x17, 0x03, 0x09,
+	0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x06, 0x03, 0x13, 0x13, 0x11, 0x40, 0x1c,
+	0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x03, 0x01, 0x11, 0x04,
+	0x01, 0x18, 0x04, 0x01, 0x18, 0x05, 0x01, 0x18, 0x04, 0x01, 0x18, 0x04, 0x18, 0x11, 0x13, 0x13,
+	0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x07, 0x03, 0x23, 0x23, 0x23, 0x16, 0x01, 0x23, 0x2a, 0x01, 0x17,
+	0x04, 0x01, 0x17, 0x04, 0x01, 0x17, 0x04, 0x01, 0x17, 0x04, 0x01, 0x17, 0x04, 0x01, 0x17, 0x03,
+	0x01, 0x11, 0x09, 0x01, 0x1b, 0x05, 0x01, 0x18, 0x09, 0x13, 0x11, 0x13, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x05, 0x17,
+	0x00, 0x00, 0x17, 0x13, 0x04, 0x01, 0x23, 0x19, 0x04, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x04, 0x17,
+	0x17, 0x17, 0x17, 0x06, 0x04, 0x17, 0x17, 0x17, 0x17, 0x06, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03,
+	0x01, 0x11, 0x04, 0x01, 0x29, 0x0f, 0x01, 0x29, 0x04, 0x02, 0x11, 0x13, 0x04, 0x0e, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x04, 0x03, 0x17, 0x03,
+	0x13, 0x1d, 0x06, 0x2b, 0x2b, 0x2b, 0x02, 0x02, 0x2b, 0x03, 0x01, 0x11, 0x04, 0x01, 0x21, 0x04,
+	0x01, 0x29, 0x05, 0x01, 0x29, 0x04, 0x01, 0x21, 0x04, 0x02, 0x11, 0x13, 0x04, 0x0a, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x03, 0x08, 0x17, 0x00, 0x17, 0x17, 0x17, 0x03,
+	0x03, 0x11, 0x1c, 0x08, 0x2c, 0x2c, 0x2b, 0x14, 0x2c, 0x02, 0x02, 0x22, 0x03, 0x01, 0x11, 0x04,
+	0x01, 0x29, 0x04, 0x01, 0x29, 0x05, 0x01, 0x29, 0x04, 0x01, 0x29, 0x04, 0x16, 0x11, 0x13, 0x13,
+	0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x00, 0x17, 0x03, 0x01, 0x13, 0x1c, 0x08, 0x22, 0x22, 0x19, 0x2b, 0x22, 0x19, 0x02, 0x22,
+	0x03, 0x01, 0x11, 0x09, 0x01, 0x29, 0x05, 0x01, 0x29, 0x09, 0x08, 0x11, 0x13, 0x13, 0x00, 0x00,
+	0x17, 0x17, 0x17, 0x03, 0x07, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x04, 0x04, 0x17, 0x00,
+	0x03, 0x1f, 0x1c, 0x07, 0x24, 0x18, 0x18, 0x2d, 0x2d, 0x2d, 0x2d, 0x03, 0x01, 0x12, 0x04, 0x01,
+	0x26, 0x0f, 0x01, 0x26, 0x04, 0x02, 0x12, 0x13, 0x04, 0x02, 0x17, 0x17, 0x04, 0x02, 0x17, 0x17,
+	0x09, 0x06, 0x17, 0x13, 0x13, 0x06, 0x0e, 0x18, 0x10, 0x03, 0x25, 0x25, 0x2d, 0x06, 0x09, 0x26,
+	0x0e, 0x27, 0x27, 0x27, 0x27, 0x0e, 0x0e, 0x27, 0x03, 0x01, 0x11, 0x04, 0x01, 0x26, 0x04, 0x01,
+	0x27, 0x05, 0x01, 0x27, 0x04, 0x01, 0x26, 0x04, 0x02, 0x11, 0x13, 0x04, 0x02, 0x17, 0x17, 0x0f,
+	0x07, 0x17, 0x13, 0x13, 0x11, 0x1d, 0x1a, 0x1b, 0x0e, 0x05, 0x2a, 0x2a, 0x2a, 0x27, 0x26, 0x05,
+	0x0a, 0x2a, 0x15, 0x15, 0x15, 0x15, 0x15, 0x1f, 0x15, 0x13, 0x19, 0x03, 0x01, 0x11, 0x19, 0x08,
+	0x11, 0x13, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05, 0x01, 0x17, 0x03, 0x01, 0x17, 0x05, 0x08,
+	0x17, 0x17, 0x13, 0x04, 0x05, 0x1d, 0x1a, 0x19, 0x08, 0x02, 0x26, 0x27, 0x03, 0x01, 0x14, 0x03,
+	0x02, 0x28, 0x27, 0x05, 0x0a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0a, 0x18, 0x0a, 0x0b, 0x1e, 0x03,
+	0x03, 0x1e, 0x18, 0x1b, 0x03, 0x01, 0x11, 0x04, 0x01, 0x28, 0x04, 0x01, 0x26, 0x05, 0x01, 0x26,
+	0x04, 0x01, 0x28, 0x04, 0x07, 0x11, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x06, 0x01, 0x17, 0x03,
+	0x01, 0x17, 0x04, 0x09, 0x17, 0x17, 0x17, 0x00, 0x13, 0x04, 0x05, 0x1d, 0x1a, 0x07, 0x0c, 0x28,
+	0x11, 0x1f, 0x19, 0x18, 0x18, 0x0b, 0x1a, 0x0a, 0x18, 0x17, 0x15, 0x06, 0x10, 0x1d, 0x1d, 0x1d,
+	0x1d, 0x08, 0x1d, 0x08, 0x07, 0x12, 0x06, 0x06, 0x12, 0x08, 0x0b, 0x18, 0x18, 0x0f, 0x02, 0x26,
+	0x27, 0x03, 0x0c, 0x11, 0x1d, 0x2b, 0x2b, 0x19, 0x14, 0x15, 0x15, 0x28, 0x28, 0x2a, 0x28, 0x03,
+	0x0c, 0x28, 0x2a, 0x28, 0x28, 0x2b, 0x2b, 0x15, 0x19, 0x0c, 0x0c, 0x1d, 0x11, 0x0b, 0x01, 0x17,
+	0x03, 0x01, 0x17, 0x05, 0x01, 0x17, 0x04, 0x05, 0x13, 0x04, 0x11, 0x1d, 0x1a, 0x06, 0x0d, 0x19,
+	0x0d, 0x0a, 0x1a, 0x0e, 0x07, 0x12, 0x12, 0x1d, 0x0e, 0x0b, 0x18, 0x19, 0x06, 0x0a, 0x11, 0x11,
+	0x05, 0x05, 0x11, 0x05, 0x05, 0x1f, 0x1f, 0x11, 0x03, 0x03, 0x1e, 0x1e, 0x1e, 0x0d, 0x04, 0x26,
+	0x27, 0x2a, 0x2a, 0x04, 0x0b, 0x21, 0x2b, 0x2e, 0x21, 0x19, 0x21, 0x21, 0x21, 0x15, 0x21, 0x21,
+	0x03, 0x0a, 0x15, 0x21, 0x21, 0x2b, 0x2f, 0x2e, 0x21, 0x0c, 0x21, 0x21, 0x0d, 0x01, 0x17, 0x03,
+	0x01, 0x17, 0x06, 0x02, 0x17, 0x17, 0x04, 0x0f, 0x13, 0x11, 0x1d, 0x09, 0x1e, 0x1a, 0x1a, 0x1a,
+	0x0b, 0x0b, 0x1e, 0x08, 0x12, 0x11, 0x11, 0x03, 0x09, 0x11, 0x12, 0x0e, 0x0b, 0x1e, 0x1e, 0x1d,
+	0x11, 0x1f, 0x04, 0x0d, 0x13, 0x03, 0x03, 0x13, 0x13, 0x13, 0x13, 0x05, 0x11, 0x07, 0x1d, 0x1d,
+	0x1d, 0x0c, 0x01, 0x27, 0x03, 0x07, 0x15, 0x28, 0x1d, 0x0e, 0x26, 0x2d, 0x2b, 0x2d, 0x01, 0x17,
+	0x07, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x03, 0x11, 0x11, 0x12, 0x03, 0x06, 0x12, 0x06, 0x11,
+	0x05, 0x1f, 0x13, 0x06, 0x08, 0x11, 0x12, 0x12, 0x12, 0x11, 0x04, 0x03, 0x13, 0x03, 0x0d, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x13, 0x03, 0x04, 0x1f, 0x11, 0x11, 0x06, 0x12, 0x0b, 0x02, 0x27, 0x28,
+	0x04, 0x03, 0x14, 0x15, 0x28, 0x03, 0x01, 0x2d, 0x35, 0x1d, 0x17, 0x17, 0x00, 0x17, 0x00, 0x13,
+	0x03, 0x13, 0x13, 0x1f, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x13, 0x13, 0x03, 0x13, 0x00, 0x17, 0x00,
+	0x17, 0x13, 0x03, 0x04, 0x1f, 0x1f, 0x13, 0x04, 0x01, 0x17, 0x06, 0x01, 0x17, 0x08, 0x02, 0x0e,
+	0x1b, 0x0a, 0x08, 0x15, 0x1b, 0x0a, 0x1a, 0x0b, 0x1a, 0x10, 0x19, 0x03, 0x01, 0x26, 0x28, 0x04,
+	0x17, 0x17, 0x17, 0x17, 0x08, 0x0e, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x13, 0x13,
+	0x13, 0x13, 0x03, 0x13, 0x05, 0x10, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x13, 0x13, 0x13,
+	0x13, 0x13, 0x00, 0x17, 0x17, 0x17, 0x06, 0x0b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x03, 0x13,
+	0x11, 0x0e, 0x1b, 0x09, 0x0c, 0x15, 0x1b, 0x1a, 0x0e, 0x12, 0x07, 0x1d, 0x0e, 0x1a, 0x0d, 0x14,
+	0x2b, 0x22, 0x02, 0x1e, 0x12, 0x03, 0x06, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x07, 0x0d, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x07, 0x01, 0x17, 0x05,
+	0x06, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x09, 0x02, 0x17, 0x17, 0x03, 0x09, 0x17, 0x00, 0x13,
+	0x11, 0x0e, 0x10, 0x15, 0x26, 0x24, 0x06, 0x01, 0x14, 0x06, 0x06, 0x11, 0x1d, 0x1e, 0x02, 0x17,
+	0x14, 0x24, 0x03, 0x11, 0x03, 0x17, 0x04, 0x02, 0x17, 0x17, 0x07, 0x01, 0x17, 0x05, 0x03, 0x17,
+	0x17, 0x17, 0x0c, 0x08, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x05, 0x01, 0x17, 0x07,
+	0x0b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x13, 0x11, 0x1d, 0x18, 0x15, 0x08, 0x01, 0x19, 0x07,
+	0x05, 0x11, 0x1d, 0x02, 0x0a, 0x18, 0x21, 0x01, 0x15, 0x03, 0x12, 0x13, 0x00, 0x17, 0x00, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x03, 0x07, 0x17,
+	0x00, 0x17, 0x17, 0x00, 0x17, 0x17, 0x05, 0x05, 0x17, 0x17, 0x00, 0x00, 0x17, 0x05, 0x09, 0x17,
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x06, 0x01, 0x17, 0x03, 0x08, 0x17, 0x13, 0x1f,
+	0x07, 0x0b, 0x19, 0x12, 0x26, 0x0c, 0x07, 0x13, 0x03, 0x11, 0x12, 0x02, 0x09, 0x1e, 0x10, 0x03,
+	0x2b, 0x2d, 0x2b, 0x05, 0x01, 0x26, 0x08, 0x01, 0x14, 0x03, 0x0e, 0x13, 0x00, 0x17, 0x00, 0x17,
+	0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x03, 0x0c, 0x17, 0x17, 0x17, 0x17, 0x00,
+	0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x03, 0x06, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x04,
+	0x0a, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x03, 0x0a, 0x17, 0x17, 0x00,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x03, 0x03, 0x15, 0x1d, 0x26, 0x06, 0x01, 0x0e, 0x03,
+	0x07, 0x17, 0x17, 0x13, 0x1f, 0x11, 0x2b, 0x1d, 0x13, 0x01, 0x2d, 0x03, 0x02, 0x26, 0x26, 0x09,
+	0x03, 0x1e, 0x12, 0x1f, 0x09, 0x01, 0x17, 0x04, 0x04, 0x17, 0x00, 0x00, 0x17, 0x05, 0x02, 0x17,
+	0x17, 0x03, 0x01, 0x17, 0x03, 0x07, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x03, 0x11, 0x17,
+	0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17,
+	0x04, 0x02, 0x17, 0x13, 0x0c, 0x09, 0x0e, 0x11, 0x13, 0x17, 0x17, 0x13, 0x13, 0x11, 0x12, 0x09,
+	0x09, 0x28, 0x28, 0x2a, 0x27, 0x26, 0x1e, 0x1e, 0x26, 0x26, 0x04, 0x04, 0x27, 0x2a, 0x2a, 0x2a,
+	0x08, 0x03, 0x0e, 0x11, 0x13, 0x03, 0x03, 0x17, 0x17, 0x17, 0x03, 0x01, 0x17, 0x04, 0x04, 0x17,
+	0x00, 0x00, 0x17, 0x05, 0x05, 0x17, 0x17, 0x00, 0x00, 0x17, 0x05, 0x1a, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00,
+	0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x04, 0x05, 0x17, 0x13, 0x03, 0x11, 0x12, 0x09, 0x07, 0x1e,
+	0x11, 0x13, 0x13, 0x00, 0x03, 0x13, 0x06, 0x03, 0x15, 0x19, 0x19, 0x04, 0x01, 0x15, 0x07, 0x06,
+	0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x08, 0x10, 0x1f, 0x13, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x04, 0x01, 0x17, 0x03, 0x05, 0x17, 0x17, 0x00,
+	0x17, 0x17, 0x06, 0x04, 0x17, 0x00, 0x00, 0x17, 0x06, 0x0c, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17,
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x03, 0x01, 0x17, 0x03, 0x07, 0x17, 0x17, 0x17, 0x13, 0x13,
+	0x05, 0x1d, 0x08, 0x07, 0x1a, 0x12, 0x13, 0x13, 0x00, 0x03, 0x13, 0x06, 0x01, 0x18, 0x05, 0x0f,
+	0x18, 0x18, 0x1b, 0x13, 0x13, 0x15, 0x15, 0x14, 0x17, 0x18, 0x0a, 0x18, 0x18, 0x18, 0x18, 0x08,
+	0x03, 0x13, 0x13, 0x17, 0x03, 0x08, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x07, 0x04,
+	0x17, 0x17, 0x17, 0x17, 0x0b, 0x02, 0x17, 0x17, 0x0b, 0x01, 0x17, 0x03, 0x01, 0x17, 0x03, 0x01,
+	0x17, 0x03, 0x0a, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x13, 0x04, 0x12, 0x08, 0x08, 0x1a,
+	0x12, 0x1f, 0x13, 0x17, 0x13, 0x13, 0x12, 0x06, 0x01, 0x0e, 0x07, 0x0d, 0x1e, 0x0a, 0x0a, 0x18,
+	0x18, 0x1a, 0x09, 0x0e, 0x08, 0x1d, 0x0e, 0x0e, 0x1e, 0x09, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x03, 0x02, 0x17, 0x17, 0x0a, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x01, 0x17, 0x1a, 0x01,
+	0x17, 0x03, 0x0a, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x04, 0x12, 0x08, 0x09, 0x1a,
+	0x12, 0x1f, 0x13, 0x17, 0x13, 0x1f, 0x12, 0x1e, 0x06, 0x08, 0x11, 0x11, 0x1f, 0x13, 0x1f, 0x1f,
+	0x11, 0x11, 0x04, 0x09, 0x0e, 0x07, 0x06, 0x11, 0x05, 0x11, 0x11, 0x11, 0x12, 0x0a, 0x01, 0x17,
+	0x04, 0x03, 0x17, 0x17, 0x17, 0x0c, 0x05, 0x17, 0x17, 0x17, 0x00, 0x17, 0x04, 0x01, 0x17, 0x06,
+	0x02, 0x17, 0x17, 0x05, 0x08, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x05, 0x03, 0x17,
+	0x00, 0x17, 0x04, 0x06, 0x17, 0x17, 0x17, 0x13, 0x04, 0x1d, 0x09, 0x09, 0x11, 0x13, 0x13, 0x17,
+	0x13, 0x1f, 0x06, 0x09, 0x2b, 0x05, 0x0a, 0x1f, 0x13, 0x13, 0x13, 0x13, 0x03, 0x13, 0x03, 0x13,
+	0x13, 0x03, 0x0a, 0x11, 0x05, 0x1f, 0x03, 0x03, 0x13, 0x13, 0x13, 0x11, 0x11, 0x05, 0x0b, 0x11,
+	0x13, 0x03, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0e, 0x04, 0x17, 0x00, 0x00, 0x17,
+	0x05, 0x01, 0x17, 0x04, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x09, 0x17, 0x00, 0x17, 0x00,
+	0x00, 0x17, 0x17, 0x00, 0x17, 0x05, 0x01, 0x17, 0x08, 0x03, 0x13, 0x04, 0x1d, 0x0a, 0x07, 0x13,
+	0x17, 0x00, 0x13, 0x04, 0x06, 0x1e, 0x05, 0x05, 0x13, 0x13, 0x17, 0x00, 0x17, 0x05, 0x0d, 0x13,
+	0x03, 0x13, 0x03, 0x03, 0x13, 0x13, 0x17, 0x17, 0x13, 0x13, 0x13, 0x11, 0x04, 0x05, 0x12, 0x05,
+	0x03, 0x13, 0x17, 0x05, 0x02, 0x17, 0x17, 0x0e, 0x06, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x04,
+	0x01, 0x17, 0x03, 0x0e, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00,
+	0x00, 0x17, 0x03, 0x01, 0x17, 0x07, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x01, 0x1f, 0x0d, 0x04,
+	0x17, 0x13, 0x04, 0x12, 0x06, 0x02, 0x17, 0x17, 0x03, 0x07, 0x17, 0x17, 0x17, 0x17, 0x00, 0x03,
+	0x13, 0x11, 0x02, 0x13, 0x17, 0x05, 0x02, 0x17, 0x17, 0x0f, 0x06, 0x17, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x06, 0x01, 0x17, 0x04, 0x10, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x04, 0x06, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0d, 0x06,
+	0x13, 0x17, 0x00, 0x00, 0x13, 0x13, 0x12, 0x02, 0x2a, 0x2a, 0x07, 0x01, 0x17, 0x03, 0x08, 0x17,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x0d, 0x05, 0x12, 0x05, 0x03, 0x17, 0x17, 0x04, 0x04,
+	0x17, 0x17, 0x17, 0x17, 0x0e, 0x03, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x04, 0x17, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x03, 0x02, 0x17, 0x17, 0x03, 0x01, 0x17, 0x0c, 0x04, 0x13, 0x13,
+	0x17, 0x17, 0x06, 0x02, 0x18, 0x18, 0x0c, 0x04, 0x15, 0x15, 0x15, 0x15, 0x03, 0x06, 0x17, 0x17,
+	0x17, 0x00, 0x00, 0x17, 0x03, 0x07, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x0e, 0x0c, 0x11,
+	0x03, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0f, 0x01, 0x17, 0x05, 0x01,
+	0x17, 0x03, 0x20, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00,
+	0x17, 0x00, 0x17, 0x0b, 0x06, 0x13, 0x03, 0x00, 0x17, 0x17, 0x17, 0x04, 0x04, 0x1e, 0x0a, 0x10,
+	0x18, 0x0a, 0x01, 0x14, 0x04, 0x01, 0x1b, 0x03, 0x02, 0x15, 0x2b, 0x02, 0x11, 0x17, 0x00, 0x00,
+	0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x0e, 0x0c,
+	0x11, 0x03, 0x13, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x01, 0x17, 0x07,
+	0x1a, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00,
+	0x00, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x09, 0x01, 0x13, 0x03, 0x0b,
+	0x17, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x12, 0x0e, 0x0a, 0x10, 0x18, 0x09, 0x0d, 0x19, 0x18, 0x18,
+	0x0b, 0x1a, 0x0b, 0x1e, 0x1e, 0x0b, 0x1a, 0x10, 0x2b, 0x15, 0x02, 0x0b, 0x17, 0x00, 0x00, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x03, 0x17, 0x17, 0x17, 0x0f, 0x01, 0x13, 0x05,
+	0x04, 0x17, 0x17, 0x17, 0x17, 0x19, 0x0b, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x03, 0x0e, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17,
+	0x17, 0x17, 0x05, 0x01, 0x17, 0x09, 0x0f, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x13,
+	0x13, 0x11, 0x1d, 0x0b, 0x0a, 0x18, 0x08, 0x0f, 0x1b, 0x0a, 0x1e, 0x0e, 0x1d, 0x1d, 0x07, 0x12,
+	0x06, 0x12, 0x1d, 0x1e, 0x02, 0x0d, 0x19, 0x02, 0x0c, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00,
+	0x17, 0x17, 0x17, 0x00, 0x17, 0x1b, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x0b, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x05, 0x0d, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x06, 0x01, 0x17, 0x08, 0x0f, 0x17, 0x17, 0x17,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x11, 0x08, 0x0e, 0x1e, 0x05, 0x06, 0x18, 0x2b,
+	0x18, 0x1a, 0x09, 0x1d, 0x05, 0x07, 0x1f, 0x11, 0x11, 0x1d, 0x02, 0x0b, 0x18, 0x03, 0x0f, 0x17,
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x01,
+	0x17, 0x04, 0x01, 0x17, 0x15, 0x0f, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x00, 0x17, 0x00, 0x17, 0x17, 0x03, 0x07, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x03, 0x09,
+	0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x08, 0x01, 0x17, 0x06, 0x06, 0x17, 0x17,
+	0x13, 0x03, 0x04, 0x11, 0x06, 0x0a, 0x1d, 0x09, 0x2b, 0x09, 0x0e, 0x12, 0x11, 0x1f, 0x13, 0x13,
+	0x03, 0x05, 0x13, 0x11, 0x12, 0x2b, 0x0e, 0x03, 0x0f, 0x13, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17,
+	0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x0b, 0x01, 0x0e, 0x0a, 0x05, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x16, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x06, 0x05, 0x17, 0x17, 0x17, 0x00, 0x17,
+	0x03, 0x02, 0x17, 0x17, 0x06, 0x0a, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17,
+	0x05, 0x03, 0x17, 0x17, 0x17, 0x04, 0x06, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x04, 0x01, 0x11,
+	0x04, 0x07, 0x12, 0x1d, 0x2b, 0x1d, 0x07, 0x11, 0x1f, 0x03, 0x06, 0x17, 0x03, 0x03, 0x13, 0x11,
+	0x12, 0x02, 0x01, 0x23, 0x03, 0x0c, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17,
+	0x17, 0x13, 0x0a, 0x01, 0x0e, 0x26, 0x0d, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x03, 0x01, 0x17, 0x04, 0x0a, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17,
+	0x00, 0x00, 0x17, 0x03, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x0e, 0x17, 0x00, 0x17, 0x00, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x03, 0x03, 0x13, 0x03, 0x13, 0x03, 0x0f,
+	0x11, 0x07, 0x02, 0x12, 0x11, 0x1f, 0x13, 0x13, 0x17, 0x17, 0x17, 0x00, 0x03, 0x13, 0x11, 0x02,
+	0x01, 0x23, 0x03, 0x01, 0x13, 0x06, 0x04, 0x17, 0x17, 0x13, 0x2b, 0x0a, 0x01, 0x1e, 0x26, 0x07,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x05, 0x02, 0x17, 0x17, 0x03, 0x01, 0x17, 0x04, 0x06,
+	0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x04, 0x0b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x03, 0x10, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x04, 0x06, 0x12, 0x2b, 0x12, 0x11, 0x13, 0x13, 0x05, 0x02, 0x13,
+	0x13, 0x01, 0x03, 0x23, 0x23, 0x23, 0x03, 0x01, 0x21, 0x03, 0x06, 0x21, 0x21, 0x13, 0x13, 0x2b,
+	0x2f, 0x09, 0x01, 0x18, 0x13, 0x02, 0x17, 0x17, 0x12, 0x08, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17,
+	0x17, 0x17, 0x04, 0x10, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00,
+	0x00, 0x17, 0x17, 0x17, 0x05, 0x0f, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x03, 0x0d, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00,
+	0x00, 0x17, 0x00, 0x13, 0x07, 0x08, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x03, 0x01,
+	0x18, 0x01, 0x03, 0x2b, 0x2b, 0x23, 0x04, 0x04, 0x21, 0x21, 0x21, 0x2e, 0x0d, 0x01, 0x15, 0x04,
+	0x01, 0x0e, 0x0e, 0x02, 0x17, 0x17, 0x11, 0x1e, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00,
+	0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x04, 0x13, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x04, 0x0a, 0x17, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x03, 0x13, 0x06, 0x01, 0x13, 0x05, 0x01, 0x13, 0x04, 0x03, 0x1b,
+	0x1b, 0x18, 0x18, 0x01, 0x15, 0x04, 0x01, 0x1d, 0x04, 0x01, 0x1d, 0x06, 0x07, 0x17, 0x00, 0x00,
+	0x17, 0x17, 0x00, 0x17, 0x0f, 0x0e, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x03, 0x05, 0x17, 0x17, 0x00, 0x00, 0x17, 0x04, 0x16, 0x17, 0x00, 0x00,
+	0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00,
+	0x17, 0x00, 0x17, 0x04, 0x01, 0x17, 0x05, 0x08, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x06, 0x04, 0x11, 0x1f, 0x13, 0x17, 0x03, 0x02, 0x17, 0x13, 0x05, 0x03, 0x18, 0x18, 0x1e, 0x14,
+	0x02, 0x15, 0x15, 0x06, 0x01, 0x1d, 0x04, 0x01, 0x0e, 0x04, 0x09, 0x17, 0x00, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x00, 0x17, 0x0f, 0x03, 0x17, 0x00, 0x17, 0x06, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x07, 0x03, 0x17, 0x00, 0x17, 0x04, 0x02, 0x17, 0x17, 0x03, 0x08, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x04, 0x03, 0x17, 0x00, 0x17, 0x06, 0x01, 0x17, 0x04, 0x01, 0x17, 0x05, 0x03,
+	0x17, 0x00, 0x13, 0x05, 0x04, 0x11, 0x1f, 0x13, 0x17, 0x03, 0x04, 0x17, 0x13, 0x1f, 0x12, 0x03,
+	0x03, 0x1a, 0x1e, 0x1d, 0x13, 0x04, 0x28, 0x15, 0x15, 0x15, 0x09, 0x01, 0x1d, 0x06, 0x07, 0x17,
+	0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x0d, 0x05, 0x17, 0x17, 0x17, 0x00, 0x17, 0x08, 0x04, 0x17,
+	0x17, 0x17, 0x17, 0x06, 0x02, 0x17, 0x17, 0x0d, 0x0c, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00,
+	0x17, 0x17, 0x17, 0x00, 0x17, 0x07, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05, 0x02, 0x17, 0x17,
+	0x07, 0x0b, 0x12, 0x11, 0x13, 0x13, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x11, 0x03, 0x04, 0x0e,
+	0x07, 0x06, 0x11, 0x0d, 0x0c, 0x15, 0x15, 0x11, 0x12, 0x2a, 0x28, 0x15, 0x15, 0x14, 0x14, 0x14,
+	0x14, 0x06, 0x01, 0x11, 0x08, 0x02, 0x17, 0x17, 0x10, 0x04, 0x17, 0x17, 0x17, 0x17, 0x09, 0x06,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x04, 0x17, 0x17, 0x00, 0x17, 0x0c, 0x0a, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x08, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05,
+	0x04, 0x17, 0x17, 0x00, 0x17, 0x06, 0x0f, 0x12, 0x11, 0x04, 0x13, 0x17, 0x00, 0x00, 0x17, 0x13,
+	0x13, 0x11, 0x12, 0x08, 0x02, 0x12, 0x03, 0x01, 0x13, 0x0c, 0x05, 0x2a, 0x11, 0x11, 0x15, 0x15,
+	0x03, 0x02, 0x1b, 0x18, 0x08, 0x01, 0x11, 0x09, 0x05, 0x17, 0x17, 0x17, 0x00, 0x17, 0x0d, 0x02,
+	0x17, 0x17, 0x0a, 0x01, 0x17, 0x05, 0x01, 0x17, 0x04, 0x02, 0x17, 0x17, 0x0e, 0x08, 0x17, 0x17,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x09, 0x06, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05, 0x02,
+	0x17, 0x17, 0x08, 0x01, 0x12, 0x03, 0x10, 0x17, 0x00, 0x00, 0x17, 0x13, 0x13, 0x05, 0x12, 0x1d,
+	0x02, 0x12, 0x11, 0x03, 0x13, 0x03, 0x1f, 0x0c, 0x04, 0x28, 0x1f, 0x13, 0x19, 0x04, 0x07, 0x1a,
+	0x1e, 0x0b, 0x0a, 0x18, 0x18, 0x18, 0x0f, 0x04, 0x17, 0x17, 0x00, 0x17, 0x0b, 0x09, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x04, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x03, 0x09, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x07, 0x01, 0x17, 0x04, 0x0d,
+	0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x05, 0x01, 0x17,
+	0x04, 0x09, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x13, 0x04, 0x12, 0x03, 0x03, 0x11, 0x13, 0x13,
+	0x03, 0x01, 0x17, 0x04, 0x03, 0x12, 0x02, 0x11, 0x03, 0x03, 0x13, 0x04, 0x11, 0x09, 0x13, 0x28,
+	0x11, 0x1f, 0x14, 0x0d, 0x0a, 0x1a, 0x1e, 0x09, 0x0e, 0x1d, 0x12, 0x1d, 0x1d, 0x1e, 0x1a, 0x10,
+	0x0d, 0x18, 0x0f, 0x04, 0x17, 0x17, 0x00, 0x17, 0x0d, 0x07, 0x17, 0x17, 0x17, 0x17, 0x13, 0x21,
+	0x21, 0x10, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x06, 0x06, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x2b, 0x03, 0x0e, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x2b, 0x2b,
+	0x17, 0x17, 0x08, 0x07, 0x17, 0x17, 0x13, 0x13, 0x11, 0x2b, 0x2b, 0x09, 0x0c, 0x17, 0x13, 0x1f,
+	0x11, 0x12, 0x02, 0x06, 0x11, 0x13, 0x03, 0x00, 0x13, 0x08, 0x14, 0x15, 0x14, 0x13, 0x0d, 0x18,
+	0x1e, 0x1d, 0x12, 0x12, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x12, 0x09, 0x1a, 0x10, 0x18, 0x10,
+	0x02, 0x2b, 0x2b, 0x68, 0x01, 0x11, 0x03, 0x01, 0x2a, 0x03, 0x03, 0x15, 0x19, 0x1b, 0x06, 0x08,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x03, 0x01, 0x18, 0x7a, 0x02, 0x11, 0x13, 0x02,
+	0x08, 0x19, 0x14, 0x14, 0x13, 0x19, 0x1b, 0x18, 0x1a, 0x06, 0x0c, 0x13, 0x13, 0x17, 0x17, 0x00,
+	0x17, 0x13, 0x13, 0x11, 0x07, 0x09, 0x18, 0x03, 0x07, 0x1a, 0x18, 0x18, 0x1a, 0x1a, 0x1e, 0x0e,
+	0x06, 0x0b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x04, 0x11, 0x1d, 0x3b, 0x01, 0x21,
+	0x04, 0x03, 0x1d, 0x1d, 0x1d, 0x06, 0x07, 0x13, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x03, 0x01,
+	0x17, 0x3e, 0x03, 0x2e, 0x20, 0x2e, 0x04, 0x05, 0x11, 0x11, 0x11, 0x11, 0x11, 0x03, 0x05, 0x13,
+	0x00, 0x00, 0x17, 0x17, 0x04, 0x04, 0x17, 0x17, 0x00, 0x13, 0x3d, 0x03, 0x2e, 0x20, 0x2e, 0x41,
+	0x01, 0x17, 0x04, 0x08, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x03, 0x17, 0x03, 0x0a, 0x17, 0x00,
+	0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x3f, 0x01, 0x2f, 0x41, 0x02, 0x17, 0x17, 0x06,
+	0x13, 0x13, 0x13, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17,
+	0x00, 0x17, 0x00, 0x17, 0x3f, 0x01, 0x26, 0x33, 0x03, 0x11, 0x11, 0x11, 0x07, 0x07, 0x11, 0x13,
+	0x13, 0x17, 0x17, 0x00, 0x17, 0x07, 0x03, 0x17, 0x00, 0x17, 0x03, 0x04, 0x17, 0x00, 0x17, 0x17,
+	0x03, 0x05, 0x17, 0x00, 0x17, 0x00, 0x17, 0x3b, 0x05, 0x25, 0x25, 0x26, 0x1e, 0x26, 0x23, 0x02,
+	0x2d, 0x25, 0x0d, 0x06, 0x1d, 0x11, 0x1f, 0x11, 0x1d, 0x1e, 0x04, 0x09, 0x1d, 0x11, 0x13, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x07, 0x03, 0x17, 0x17, 0x17, 0x03, 0x11, 0x17, 0x17, 0x00, 0x00,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x03, 0x13, 0x11, 0x0e, 0x18, 0x28, 0x04, 0x26,
+	0x26, 0x26, 0x26, 0x09, 0x04, 0x27, 0x0e, 0x0e, 0x27, 0x24, 0x04, 0x26, 0x0e, 0x1d, 0x2a, 0x06,
+	0x07, 0x2a, 0x2b, 0x2a, 0x11, 0x17, 0x1e, 0x12, 0x05, 0x08, 0x1e, 0x0b, 0x1a, 0x2b, 0x12, 0x11,
+	0x13, 0x17, 0x09, 0x01, 0x17, 0x07, 0x0e, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x13,
+	0x03, 0x05, 0x12, 0x1e, 0x18, 0x1c, 0x01, 0x0e, 0x09, 0x06, 0x28, 0x28, 0x28, 0x2a, 0x2a, 0x27,
+	0x08, 0x04, 0x15, 0x11, 0x11, 0x15, 0x06, 0x04, 0x28, 0x2a, 0x2a, 0x2a, 0x0f, 0x03, 0x27, 0x27,
+	0x2a, 0x08, 0x04, 0x15, 0x13, 0x13, 0x19, 0x05, 0x01, 0x14, 0x03, 0x12, 0x19, 0x0a, 0x0e, 0x06,
+	0x04, 0x13, 0x03, 0x1f, 0x06, 0x1d, 0x08, 0x09, 0x2b, 0x06, 0x04, 0x13, 0x17, 0x17, 0x11, 0x12,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x03, 0x13, 0x05, 0x12, 0x1e, 0x0a, 0x19,
+	0x2b, 0x14, 0x09, 0x01, 0x11, 0x05, 0x03, 0x11, 0x1f, 0x13, 0x05, 0x03, 0x1d, 0x06, 0x11, 0x08,
+	0x01, 0x18, 0x04, 0x05, 0x15, 0x11, 0x15, 0x2b, 0x15, 0x03, 0x06, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x04, 0x0b, 0x18, 0x1b, 0x19, 0x14, 0x14, 0x14, 0x13, 0x14, 0x02, 0x14, 0x14, 0x08, 0x01,
+	0x15, 0x03, 0x01, 0x14, 0x05, 0x05, 0x19, 0x19, 0x18, 0x0a, 0x1a, 0x06, 0x0e, 0x18, 0x0a, 0x2b,
+	0x10, 0x18, 0x09, 0x12, 0x04, 0x03, 0x13, 0x13, 0x13, 0x04, 0x11, 0x05, 0x04, 0x13, 0x17, 0x17,
+	0x17, 0x17, 0x0d, 0x17, 0x17, 0x17, 0x17, 0x13, 0x04, 0x11, 0x12, 0x0e, 0x0a, 0x2b, 0x10, 0x18,
+	0x07, 0x03, 0x13, 0x04, 0x11, 0x03, 0x05, 0x11, 0x13, 0x13, 0x13, 0x13, 0x04, 0x03, 0x11, 0x05,
+	0x13, 0x07, 0x01, 0x1d, 0x05, 0x06, 0x18, 0x19, 0x19, 0x02, 0x0d, 0x18, 0x03, 0x15, 0x1d, 0x1d,
+	0x1d, 0x1d, 0x1d, 0x1d, 0x08, 0x08, 0x1d, 0x0e, 0x0e, 0x0b, 0x1a, 0x0a, 0x18, 0x10, 0x18, 0x2b,
+	0x0a, 0x0a, 0x1a, 0x07, 0x01, 0x19, 0x03, 0x0b, 0x1a, 0x1e, 0x1a, 0x1a, 0x1a, 0x18, 0x1a, 0x1e,
+	0x0e, 0x08, 0x12, 0x06, 0x06, 0x0e, 0x09, 0x02, 0x1e, 0x0e, 0x12, 0x06, 0x01, 0x13, 0x07, 0x03,
+	0x13, 0x17, 0x17, 0x0e, 0x01, 0x17, 0x08, 0x01, 0x17, 0x05, 0x07, 0x13, 0x05, 0x12, 0x0e, 0x02,
+	0x0b, 0x0e, 0x03, 0x04, 0x13, 0x00, 0x00, 0x17, 0x03, 0x04, 0x13, 0x04, 0x13, 0x13, 0x03, 0x08,
+	0x17, 0x13, 0x03, 0x03, 0x13, 0x04, 0x03, 0x13, 0x06, 0x0d, 0x11, 0x11, 0x05, 0x11, 0x06, 0x1d,
+	0x08, 0x1e, 0x0a, 0x18, 0x02, 0x0b, 0x0e, 0x03, 0x0a, 0x11, 0x05, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x05, 0x11, 0x11, 0x03, 0x07, 0x1d, 0x0e, 0x1e, 0x1e, 0x02, 0x09, 0x0e, 0x09, 0x06, 0x1e, 0x09,
+	0x1d, 0x12, 0x12, 0x12, 0x03, 0x05, 0x1d, 0x12, 0x11, 0x11, 0x1f, 0x03, 0x01, 0x1f, 0x03, 0x10,
+	0x1d, 0x02, 0x08, 0x12, 0x11, 0x04, 0x03, 0x17, 0x17, 0x17, 0x00, 0x03, 0x1f, 0x11, 0x2b, 0x12,
+	0x04, 0x02, 0x13, 0x13, 0x0d, 0x04, 0x17, 0x17, 0x17, 0x17, 0x06, 0x01, 0x17, 0x06, 0x05, 0x1f,
+	0x11, 0x07, 0x08, 0x2b, 0x04, 0x16, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x03, 0x13, 0x13, 0x13,
+	0x03, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x13, 0x13, 0x13, 0x03, 0x17, 0x06, 0x0d, 0x13, 0x13,
+	0x03, 0x13, 0x1f, 0x11, 0x06, 0x12, 0x0e, 0x0e, 0x02, 0x08, 0x12, 0x03, 0x0b, 0x13, 0x13, 0x03,
+	0x13, 0x13, 0x13, 0x13, 0x03, 0x13, 0x13, 0x13, 0x05, 0x04, 0x1d, 0x08, 0x02, 0x12, 0x08, 0x0d,
+	0x12, 0x06, 0x05, 0x11, 0x1f, 0x1f, 0x04, 0x11, 0x11, 0x11, 0x05, 0x1f, 0x13, 0x03, 0x17, 0x13,
+	0x13, 0x13, 0x13, 0x04, 0x06, 0x12, 0x07, 0x02, 0x11, 0x1f, 0x03, 0x03, 0x17, 0x00, 0x00, 0x17,
+	0x13, 0x1f, 0x06, 0x2b, 0x07, 0x12, 0x03, 0x01, 0x13, 0x07, 0x01, 0x17, 0x06, 0x04, 0x17, 0x17,
+	0x17, 0x17, 0x05, 0x26, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x04, 0x11, 0x12, 0x1d, 0x02,
+	0x11, 0x04, 0x13, 0x13, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x07, 0x01, 0x17, 0x06, 0x04, 0x12,
+	0x07, 0x1d, 0x2b, 0x05, 0x09, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x05, 0x05,
+	0x11, 0x12, 0x1d, 0x02, 0x11, 0x09, 0x0b, 0x13, 0x13, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13,
+	0x03, 0x13, 0x05, 0x03, 0x17, 0x17, 0x13, 0x03, 0x10, 0x1d, 0x2b, 0x11, 0x1f, 0x13, 0x00, 0x17,
+	0x17, 0x17, 0x17, 0x13, 0x1f, 0x11, 0x2b, 0x07, 0x12, 0x07, 0x01, 0x17, 0x07, 0x06, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x04, 0x19, 0x17, 0x17, 0x17, 0x17, 0x03, 0x04, 0x11, 0x12, 0x07, 0x02,
+	0x11, 0x04, 0x03, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x03,
+	0x08, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x06, 0x01, 0x17, 0x08, 0x04, 0x12, 0x07,
+	0x02, 0x11, 0x03, 0x14, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x13, 0x04, 0x11, 0x12, 0x1d, 0x2b, 0x11, 0x07, 0x01, 0x13, 0x03, 0x03, 0x17, 0x00, 0x17,
+	0x06, 0x01, 0x17, 0x03, 0x06, 0x17, 0x17, 0x17, 0x03, 0x04, 0x11, 0x03, 0x04, 0x11, 0x1f, 0x13,
+	0x17, 0x04, 0x02, 0x13, 0x1f, 0x07, 0x04, 0x17, 0x00, 0x00, 0x17, 0x05, 0x09, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x05, 0x12, 0x13, 0x11, 0x12, 0x07, 0x02, 0x11, 0x04, 0x13,
+	0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x06, 0x03, 0x17, 0x17, 0x17, 0x08,
+	0x0f, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x04, 0x05, 0x12, 0x07, 0x02, 0x11,
+	0x03, 0x16, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x03,
+	0x13, 0x11, 0x12, 0x12, 0x02, 0x11, 0x04, 0x13, 0x04, 0x03, 0x17, 0x17, 0x17, 0x03, 0x01, 0x17,
+	0x04, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x05, 0x17, 0x17, 0x03, 0x13, 0x11, 0x07, 0x07, 0x17,
+	0x17, 0x17, 0x13, 0x13, 0x11, 0x12, 0x06, 0x01, 0x17, 0x03, 0x01, 0x17, 0x04, 0x14, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x11,
+	0x12, 0x2b, 0x03, 0x06, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x01, 0x17, 0x07, 0x01, 0x17,
+	0x04, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x10, 0x17, 0x17, 0x17, 0x03, 0x03,
+	0x11, 0x12, 0x07, 0x2b, 0x11, 0x04, 0x03, 0x17, 0x17, 0x17, 0x17, 0x06, 0x01, 0x17, 0x03, 0x14,
+	0x17, 0x13, 0x1f, 0x11, 0x12, 0x02, 0x12, 0x05, 0x03, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00,
+	0x17, 0x00, 0x00, 0x17, 0x03, 0x04, 0x17, 0x17, 0x17, 0x17, 0x05, 0x06, 0x17, 0x17, 0x17, 0x13,
+	0x04, 0x11, 0x09, 0x01, 0x13, 0x06, 0x04, 0x17, 0x00, 0x00, 0x17, 0x06, 0x10, 0x17, 0x17, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x04, 0x14, 0x23,
+	0x13, 0x13, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x03, 0x0c, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x03, 0x04, 0x13, 0x1f, 0x11, 0x12, 0x05, 0x05, 0x17, 0x17, 0x17, 0x00, 0x17, 0x05, 0x07,
+	0x17, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x11, 0x04, 0x0d, 0x13, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x06, 0x0c, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x13, 0x1f, 0x11, 0x1d, 0x08, 0x04, 0x13, 0x13, 0x11, 0x1d, 0x06, 0x0d, 0x17, 0x00, 0x00, 0x17,
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x05, 0x03, 0x17, 0x17, 0x17, 0x03, 0x01,
+	0x13, 0x04, 0x04, 0x23, 0x23, 0x23, 0x13, 0x03, 0x0d, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x12, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x06, 0x07, 0x13, 0x13, 0x17, 0x17,
+	0x00, 0x17, 0x17, 0x04, 0x06, 0x17, 0x17, 0x17, 0x17, 0x03, 0x13, 0x09, 0x02, 0x17, 0x17, 0x06,
+	0x0e, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x07,
+	0x02, 0x1e, 0x1d, 0x04, 0x06, 0x13, 0x13, 0x11, 0x08, 0x1a, 0x18, 0x09, 0x09, 0x17, 0x00, 0x00,
+	0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x03, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x01, 0x13,
+	0x05, 0x01, 0x23, 0x0b, 0x02, 0x17, 0x17, 0x03, 0x02, 0x17, 0x17, 0x04, 0x05, 0x17, 0x00, 0x00,
+	0x17, 0x17, 0x06, 0x09, 0x17, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x11, 0x08, 0x0e, 0x05, 0x12, 0x17,
+	0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x03, 0x13, 0x11, 0x1d,
+	0x0e, 0x05, 0x03, 0x17, 0x17, 0x17, 0x06, 0x01, 0x17, 0x03, 0x02, 0x17, 0x17, 0x04, 0x01, 0x17,
+	0x0a, 0x08, 0x1a, 0x1e, 0x12, 0x05, 0x03, 0x13, 0x13, 0x13, 0x03, 0x01, 0x18, 0x08, 0x01, 0x17,
+	0x03, 0x01, 0x17, 0x07, 0x06, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x04, 0x03, 0x13, 0x13, 0x11,
+	0x0d, 0x0b, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x04, 0x03, 0x17,
+	0x17, 0x17, 0x04, 0x0c, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x11, 0x0e, 0x0b, 0x1a,
+	0x03, 0x14, 0x1f, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x13, 0x13, 0x11, 0x0e, 0x0b, 0x1a, 0x03, 0x04, 0x1f, 0x13, 0x17, 0x17, 0x03, 0x04, 0x17, 0x17,
+	0x17, 0x17, 0x03, 0x03, 0x17, 0x17, 0x17, 0x0d, 0x08, 0x18, 0x18, 0x1e, 0x1d, 0x11, 0x13, 0x13,
+	0x13, 0x04, 0x01, 0x1a, 0x08, 0x04, 0x17, 0x00, 0x00, 0x17, 0x08, 0x01, 0x17, 0x03, 0x0c, 0x17,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x13, 0x13, 0x11, 0x0e, 0x1a, 0x18, 0x07, 0x06, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x05, 0x0a, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x03,
+	0x04, 0x17, 0x00, 0x00, 0x17, 0x03, 0x0c, 0x13, 0x13, 0x11, 0x0e, 0x0b, 0x18, 0x0a, 0x09, 0x12,
+	0x11, 0x13, 0x13, 0x06, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x11, 0x0e, 0x1a, 0x18,
+	0x0a, 0x09, 0x12, 0x11, 0x13, 0x13, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x06,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0a, 0x0c, 0x1a, 0x1a, 0x1e, 0x1d, 0x05, 0x13, 0x13, 0x17,
+	0x03, 0x13, 0x11, 0x1d, 0x04, 0x02, 0x17, 0x17, 0x05, 0x01, 0x17, 0x09, 0x0f, 0x17, 0x00, 0x00,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x11, 0x08, 0x0b, 0x18, 0x06, 0x07, 0x17, 0x00,
+	0x00, 0x17, 0x17, 0x17, 0x17, 0x05, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x03, 0x17, 0x17, 0x17,
+	0x03, 0x04, 0x17, 0x00, 0x00, 0x17, 0x03, 0x0a, 0x13, 0x13, 0x11, 0x08, 0x0b, 0x18, 0x0a, 0x1e,
+	0x1d, 0x11, 0x09, 0x0b, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x11, 0x1d, 0x0b, 0x0a, 0x18, 0x06,
+	0x01, 0x17, 0x03, 0x0d, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00,
+	0x17, 0x0a, 0x08, 0x0e, 0x1d, 0x12, 0x11, 0x03, 0x03, 0x17, 0x17, 0x03, 0x03, 0x17, 0x00, 0x17,
+	0x05, 0x01, 0x17, 0x0a, 0x03, 0x17, 0x00, 0x17, 0x06, 0x04, 0x13, 0x11, 0x07, 0x0e, 0x07, 0x01,
+	0x17, 0x03, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x03, 0x17,
+	0x17, 0x17, 0x04, 0x0c, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x11, 0x07, 0x0e,
+	0x03, 0x01, 0x1d, 0x0b, 0x09, 0x17, 0x17, 0x17, 0x17, 0x13, 0x11, 0x07, 0x09, 0x1a, 0x07, 0x01,
+	0x17, 0x03, 0x0a, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x01, 0x17,
+	0x0a, 0x05, 0x11, 0x11, 0x13, 0x03, 0x17, 0x02, 0x01, 0x17, 0x03, 0x01, 0x17, 0x04, 0x01, 0x17,
+	0x0b, 0x01, 0x17, 0x07, 0x03, 0x13, 0x04, 0x11, 0x09, 0x04, 0x17, 0x00, 0x00, 0x17, 0x03, 0x08,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x09, 0x03, 0x17, 0x00, 0x17, 0x07, 0x01, 0x11,
+	0x08, 0x01, 0x17, 0x0b, 0x04, 0x13, 0x04, 0x05, 0x12, 0x09, 0x04, 0x17, 0x00, 0x00, 0x17, 0x07,
+	0x01, 0x17, 0x03, 0x01, 0x17, 0x0c, 0x04, 0x13, 0x03, 0x03, 0x17, 0x03, 0x04, 0x17, 0x00, 0x00,
+	0x17, 0x03, 0x01, 0x17, 0x0f, 0x07, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x13, 0x0b, 0x03, 0x17,
+	0x17, 0x17, 0x06, 0x01, 0x17, 0x04, 0x01, 0x17, 0x09, 0x01, 0x17, 0x11, 0x03, 0x17, 0x00, 0x17,
+	0x0a, 0x02, 0x13, 0x13, 0x0b, 0x02, 0x17, 0x17, 0x08, 0x04, 0x17, 0x00, 0x00, 0x17, 0x0d, 0x03,
+	0x13, 0x17, 0x17, 0x03, 0x01, 0x17, 0x03, 0x04, 0x17, 0x00, 0x00, 0x17, 0x09, 0x02, 0x17, 0x17,
+	0x03, 0x06, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05, 0x17, 0x17, 0x00, 0x00, 0x17, 0x06,
+	0x02, 0x17, 0x17, 0x13, 0x03, 0x17, 0x00, 0x17, 0x0d, 0x02, 0x13, 0x13, 0x13, 0x02, 0x17, 0x17,
+	0x04, 0x04, 0x17, 0x00, 0x00, 0x17, 0x0b, 0x0d, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x0f, 0x04, 0x17, 0x17, 0x17, 0x17, 0x05, 0x03, 0x17, 0x17, 0x17,
+	0x05, 0x04, 0x17, 0x00, 0x00, 0x17, 0x14, 0x01, 0x17, 0x05, 0x03, 0x17, 0x17, 0x17, 0x04, 0x03,
+	0x17, 0x03, 0x13, 0x08, 0x02, 0x17, 0x17, 0x14, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x04, 0x17,
+	0x17, 0x17, 0x17, 0x05, 0x01, 0x17, 0x05, 0x07, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x04,
+	0x03, 0x17, 0x00, 0x17, 0x0d, 0x06, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x0d, 0x05, 0x17, 0x00,
+	0x17, 0x17, 0x17, 0x03, 0x04, 0x17, 0x17, 0x17, 0x17, 0x06, 0x02, 0x17, 0x17, 0x03, 0x01, 0x17,
+	0x04, 0x05, 0x17, 0x00, 0x17, 0x17, 0x17, 0x03, 0x04, 0x17, 0x00, 0x00, 0x17, 0x06, 0x05, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x05, 0x03, 0x17, 0x17, 0x17, 0x09, 0x06, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x04, 0x02, 0x17, 0x17, 0x04, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x03, 0x17, 0x00, 0x17,
+	0x05, 0x0c, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x0d, 0x0c,
+	0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x08, 0x0d, 0x17, 0x00,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x04, 0x04, 0x17, 0x00, 0x00,
+	0x17, 0x05, 0x02, 0x17, 0x17, 0x03, 0x09, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x06, 0x0e, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x07, 0x01, 0x17, 0x04, 0x08, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x08, 0x01, 0x23,
+	0x04, 0x0b, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x04, 0x09, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x04, 0x01, 0x17, 0x0c, 0x01, 0x17, 0x05, 0x07,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x06, 0x0a, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17,
+	0x00, 0x17, 0x17, 0x03, 0x02, 0x17, 0x17, 0x03, 0x05, 0x17, 0x00, 0x00, 0x17, 0x17, 0x04, 0x0d,
+	0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x08, 0x09, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x03, 0x01, 0x17, 0x07, 0x0d, 0x17, 0x17, 0x00,
+	0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x08, 0x01, 0x28, 0x04, 0x01, 0x17,
+	0x04, 0x06, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x04, 0x0e, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x0c, 0x0a, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17,
+	0x17, 0x00, 0x17, 0x17, 0x03, 0x01, 0x17, 0x05, 0x0e, 0x17, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17,
+	0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x04, 0x16, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00,
+	0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x06,
+	0x10, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00,
+	0x17, 0x05, 0x04, 0x17, 0x00, 0x00, 0x17, 0x03, 0x06, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x09,
+	0x01, 0x23, 0x04, 0x01, 0x17, 0x05, 0x05, 0x17, 0x17, 0x17, 0x00, 0x17, 0x09, 0x08, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x0c, 0x01, 0x17, 0x06, 0x07, 0x17, 0x17, 0x17, 0x17, 0x00,
+	0x00, 0x17, 0x0b, 0x03, 0x17, 0x17, 0x17, 0x04, 0x02, 0x17, 0x17, 0x03, 0x0a, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x07, 0x06, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x05,
+	0x03, 0x17, 0x00, 0x17, 0x04, 0x03, 0x17, 0x17, 0x17, 0x03, 0x04, 0x17, 0x00, 0x17, 0x17, 0x05,
+	0x01, 0x17, 0x06, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x08, 0x01, 0x23, 0x04, 0x0b,
+	0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x08, 0x04, 0x17, 0x17, 0x17,
+	0x17, 0x03, 0x01, 0x17, 0x0d, 0x05, 0x17, 0x00, 0x00, 0x17, 0x17, 0x03, 0x06, 0x17, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x06, 0x02, 0x17, 0x17, 0x03, 0x05, 0x17, 0x17, 0x00, 0x00, 0x17, 0x03, 0x01,
+	0x17, 0x04, 0x09, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x05, 0x17, 0x17,
+	0x00, 0x17, 0x17, 0x09, 0x04, 0x17, 0x00, 0x00, 0x17, 0x03, 0x02, 0x17, 0x17, 0x05, 0x0d, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x03, 0x05, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x09, 0x01, 0x23, 0x03, 0x0c, 0x13, 0x13, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x00, 0x17, 0x17, 0x03, 0x0d, 0x17, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x0d, 0x0d, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17,
+	0x17, 0x17, 0x06, 0x24, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17,
+	0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00,
+	0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x0a, 0x18, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00,
+	0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00,
+	0x17, 0x17, 0x03, 0x06, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x03, 0x02, 0x17, 0x17, 0x06, 0x03,
+	0x23, 0x1a, 0x23, 0x03, 0x09, 0x11, 0x13, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05, 0x07,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x05, 0x06, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0a,
+	0x01, 0x17, 0x05, 0x04, 0x17, 0x00, 0x00, 0x17, 0x07, 0x01, 0x17, 0x03, 0x25, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00,
+	0x17, 0x17, 0x06, 0x0a, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x04,
+	0x17, 0x00, 0x17, 0x17, 0x03, 0x13, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x13, 0x05, 0x03, 0x28, 0x1e, 0x24, 0x04, 0x07,
+	0x11, 0x13, 0x01, 0x17, 0x17, 0x17, 0x17, 0x06, 0x01, 0x17, 0x03, 0x02, 0x17, 0x17, 0x05, 0x08,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x07, 0x08, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x03, 0x06, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x03, 0x13, 0x17, 0x00, 0x00, 0x17,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x08,
+	0x03, 0x17, 0x17, 0x17, 0x04, 0x07, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x06, 0x09, 0x17,
+	0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x04, 0x06, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17,
+	0x04, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x06, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x05,
+	0x03, 0x15, 0x1d, 0x23, 0x04, 0x07, 0x12, 0x01, 0x01, 0x13, 0x13, 0x01, 0x17, 0x07, 0x05, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x05, 0x08, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x17, 0x06, 0x07,
+	0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x05, 0x0f, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00,
+	0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x03, 0x06, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x03, 0x01, 0x17, 0x06, 0x09, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x04,
+	0x17, 0x17, 0x17, 0x17, 0x04, 0x08, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17, 0x03, 0x05,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x03, 0x0b, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x04, 0x06, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x07, 0x01, 0x23, 0x07, 0x04, 0x1f,
+	0x01, 0x01, 0x13, 0x07, 0x06, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x04, 0x04, 0x17, 0x00, 0x17,
+	0x17, 0x03, 0x03, 0x17, 0x00, 0x17, 0x04, 0x01, 0x17, 0x03, 0x03, 0x17, 0x00, 0x17, 0x05, 0x0e,
+	0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x06, 0x0a,
+	0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x03, 0x01, 0x17, 0x03, 0x04, 0x17,
+	0x17, 0x00, 0x17, 0x05, 0x0a, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x04,
+	0x01, 0x17, 0x06, 0x05, 0x17, 0x17, 0x00, 0x00, 0x17, 0x04, 0x01, 0x17, 0x03, 0x05, 0x17, 0x00,
+	0x17, 0x17, 0x17, 0x03, 0x08, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x13, 0x05, 0x01, 0x2a,
+	0x0d, 0x01, 0x17, 0x05, 0x14, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00,
+	0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x04, 0x07, 0x17, 0x17, 0x00, 0x17, 0x00,
+	0x00, 0x17, 0x04, 0x05, 0x17, 0x17, 0x17, 0x00, 0x17, 0x03, 0x06, 0x17, 0x00, 0x00, 0x17, 0x00,
+	0x17, 0x06, 0x01, 0x17, 0x03, 0x0a, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17,
+	0x04, 0x05, 0x17, 0x00, 0x00, 0x17, 0x17, 0x03, 0x06, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x03,
+	0x01, 0x17, 0x05, 0x01, 0x17, 0x05, 0x06, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x03, 0x15, 0x17,
+	0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17,
+	0x00, 0x17, 0x00, 0x13, 0x04, 0x01, 0x15, 0x0c, 0x04, 0x23, 0x01, 0x17, 0x17, 0x08, 0x10, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x05,
+	0x13, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00,
+	0x00, 0x17, 0x00, 0x17, 0x04, 0x01, 0x17, 0x03, 0x02, 0x17, 0x17, 0x09, 0x13, 0x17, 0x00, 0x17,
+	0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17,
+	0x03, 0x06, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x05, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04,
+	0x03, 0x17, 0x00, 0x17, 0x03, 0x0b, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x03, 0x01, 0x17, 0x04, 0x01, 0x13, 0x0e, 0x04, 0x13, 0x03, 0x17, 0x17, 0x08, 0x04, 0x17,
+	0x17, 0x17, 0x17, 0x08, 0x05, 0x17, 0x00, 0x17, 0x17, 0x17, 0x05, 0x0a, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x00, 0x01, 0x17, 0x17, 0x05, 0x02, 0x17, 0x17, 0x04, 0x06, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x13, 0x09, 0x16, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x04, 0x02, 0x17, 0x17, 0x05, 0x05,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x05, 0x17, 0x00, 0x17, 0x17, 0x17, 0x05, 0x05, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x08, 0x03, 0x17, 0x00, 0x13, 0x10, 0x05, 0x13, 0x00, 0x17, 0x17, 0x17, 0x04,
+	0x04, 0x17, 0x17, 0x17, 0x17, 0x0b, 0x04, 0x17, 0x17, 0x17, 0x17, 0x03, 0x05, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x0a, 0x04, 0x17, 0x00, 0x17, 0x17, 0x05, 0x04, 0x17, 0x17, 0x13, 0x13, 0x0b, 0x04,
+	0x17, 0x17, 0x17, 0x17, 0x04, 0x05, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0a, 0x04, 0x17, 0x00, 0x17,
+	0x17, 0x05, 0x04, 0x17, 0x17, 0x17, 0x17, 0x06, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x04, 0x17,
+	0x17, 0x17, 0x17, 0x0b, 0x02, 0x17, 0x13, 0x0d, 0x0c, 0x23, 0x01, 0x1f, 0x01, 0x23, 0x00, 0x17,
+	0x17, 0x17, 0x00, 0x00, 0x17, 0x03, 0x01, 0x17, 0x0d, 0x02, 0x17, 0x17, 0x03, 0x04, 0x17, 0x17,
+	0x17, 0x17, 0x0d, 0x02, 0x17, 0x17, 0x04, 0x05, 0x17, 0x17, 0x17, 0x13, 0x1f, 0x0d, 0x02, 0x17,
+	0x17, 0x04, 0x04, 0x17, 0x17, 0x17, 0x17, 0x0d, 0x02, 0x17, 0x17, 0x04, 0x04, 0x17, 0x17, 0x17,
+	0x17, 0x09, 0x02, 0x17, 0x17, 0x04, 0x04, 0x17, 0x17, 0x17, 0x17, 0x0a, 0x04, 0x17, 0x00, 0x13,
+	0x13, 0x0d, 0x0d, 0x23, 0x23, 0x23, 0x23, 0x13, 0x13, 0x13, 0x17, 0x17, 0x17, 0x00, 0x21, 0x21,
+	0x03, 0x01, 0x17, 0x06, 0x0b, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00, 0x17,
+	0x04, 0x01, 0x13, 0x06, 0x09, 0x13, 0x03, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x03, 0x01,
+	0x17, 0x04, 0x01, 0x12, 0x06, 0x0c, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17, 0x00,
+	0x00, 0x17, 0x04, 0x01, 0x17, 0x06, 0x0c, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17, 0x17,
+	0x00, 0x00, 0x17, 0x04, 0x0f, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x17,
+	0x17, 0x00, 0x00, 0x17, 0x04, 0x01, 0x17, 0x0b, 0x04, 0x13, 0x13, 0x05, 0x23, 0x13, 0x02, 0x13,
+	0x13, 0x05, 0x04, 0x21, 0x21, 0x13, 0x17, 0x05, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+	0x04, 0x06, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x05, 0x07, 0x12, 0x11, 0x13, 0x13, 0x17, 0x17,
+	0x17, 0x06, 0x06, 0x17, 0x17, 0x13, 0x13, 0x11, 0x1d, 0x05, 0x07, 0x13, 0x13, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x05, 0x06, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05, 0x07, 0x17, 0x17, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x05, 0x0e, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x2b, 0x2b, 0x17, 0x17,
+	0x17, 0x17, 0x17, 0x05, 0x06, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05, 0x09, 0x17, 0x00, 0x17,
+	0x00, 0x17, 0x00, 0x13, 0x1f, 0x12, 0x91, 0x07, 0x21, 0x13, 0x13, 0x13, 0x21, 0x21, 0x21,
 };
 
 constexpr uint16_t DIGIT_COLORMAP[] = {
@@ -416,7 +760,7 @@ constexpr uint16_t DIGIT_COLORMAP[] = {
 	0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 
 	0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 
 	0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 
-	0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7
+	0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 0xdef7, 0x0000, 0x0000, 0x0000, 0xdef7, 
 };
 
 #endif
\ No newline at end of file
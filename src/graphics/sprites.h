@@ -7,20 +7,13 @@
 // -------------------------------------------------------------------------
 //                      Descriptive Data of the Sprites
 // -------------------------------------------------------------------------
-// The spritesheet incorporates all the sprites of the game in their actual
-// posture. However, it so happens that, under these conditions, the
-// rectangular envelopes of sprites necessarily overlap. This poses a
-// problem when when rendering the graphics, all the pixels of the sprites
-// are scanned. How to determine if the pixel is part of the sprite in which
-// we are interested, or to one of its neighbors?
-// 
-// To remove this indeterminacy, the sprites were colored on the spritesheet,
-// so that they could be distinguished during a scan. It is therefore
-// necessary here to specify, for each sprite, which color has been assigned
-// to it on the spritesheet.
-// 
-// You can take a look at the original image of the spritesheet to see how
-// the coloring was done (file: `assets/spritesheet.png`).
+// All the sprites of the game are drawn in black, at the very place they
+// occupy on the spritesheet (file: `assets/spritesheet.png`). Their position
+// and the pixels that compose them are declared in `assets/sprites.def` and
+// extracted once and for all by a host tool, which generates the
+// `spritesheet.h` header loaded here.
+//
+// This file names the sprites and describes how Junior moves among them.
 // -------------------------------------------------------------------------
 
 #ifndef DONKEY_KONG_JR_SPRITES
@@ -33,14 +26,101 @@
 // Sprite definition
 // -------------------------------------------------------------------------
 
+// The renderer composes the screen in horizontal slices (see `Renderer.h`).
+// Since every sprite has a fixed place on the screen, the slices it overlaps
+// and the rows it covers on each of them are known at compile time: they are
+// computed by the constructor of the sprites, which is evaluated when the
+// sprite tables are compiled, so that the renderer only has to read them.
+
+// height of the screen slices of the renderer
+#ifndef RENDERER_SLICE_HEIGHT
+    #define RENDERER_SLICE_HEIGHT 8
+#endif
+
+constexpr uint8_t SpriteSliceHeight = RENDERER_SLICE_HEIGHT; // height of a screen slice
+constexpr uint8_t SpriteMaxWidth    = 32;                    // maximum width of a sprite (one bit per pixel in a row mask)
+constexpr uint8_t SpriteMaxHeight   = 32;                    // maximum height of a sprite (bounds the slices it can overlap)
+
+// maximum number of slices a sprite can overlap
+constexpr uint8_t SpriteMaxSpan = (SpriteMaxHeight + SpriteSliceHeight - 2) / SpriteSliceHeight + 1;
+
+// the rows of a sprite that lie on one of the slices it overlaps
+struct SpriteBand {
+    uint8_t row;  // first row covered on the slice
+    uint8_t mask; // index of the corresponding row in the mask of the sprite
+    uint8_t rows; // number of rows covered on the slice
+};
+
+// sequence of indices, to initialize the bands of a sprite one by one
+template <uint8_t... I> struct SpriteIndices {};
+template <uint8_t N, uint8_t... I> struct SpriteSequence : SpriteSequence<N - 1, N - 1, I...> {};
+template <uint8_t... I> struct SpriteSequence<0, I...> { typedef SpriteIndices<I...> type; };
+
+// first and last slices overlapped by a band of rows
+constexpr uint8_t firstSlice(uint8_t y) {
+    return y / SpriteSliceHeight;
+}
+
+constexpr uint8_t lastSlice(uint8_t y, uint8_t height) {
+    return (y + height - 1) / SpriteSliceHeight;
+}
+
+// the slices overlapped by a band of rows (one bit per slice)
+constexpr uint32_t slicesOf(uint8_t y, uint8_t height) {
+    return (uint32_t)((2UL << lastSlice(y, height)) - (1UL << firstSlice(y)));
+}
+
+// the rows of a sprite that lie on a slice, given the top border
+// of the slice and the row just below it (in screen coordinates)
+constexpr SpriteBand bandOn(uint8_t y, uint8_t height, int top, int bottom) {
+    return SpriteBand {
+        (uint8_t)((y > top ? y : top) - top),
+        (uint8_t)((y > top ? y : top) - y),
+        (uint8_t)((y + height < bottom ? y + height : bottom) - (y > top ? y : top))
+    };
+}
+
+// the rows of a sprite that lie on the n-th slice it overlaps
+constexpr SpriteBand bandOf(uint8_t y, uint8_t height, uint8_t n) {
+    return firstSlice(y) + n > lastSlice(y, height)
+        ? SpriteBand { 0, 0, 0 }
+        : bandOn(y, height, (firstSlice(y) + n) * SpriteSliceHeight, (firstSlice(y) + n + 1) * SpriteSliceHeight);
+}
+
 struct Sprite {
-    uint8_t  x;      // the horizontal coordinate of the sprite on the spritesheet
-    uint8_t  y;      // the vertical coordinate of the sprite on the spritesheet
-    uint8_t  width;  // the width of the sprite
-    uint8_t  height; // the height of the sprite
-    uint16_t color;  // the color assigned to it on the spritesheet
+    uint8_t          x;      // the horizontal coordinate of the sprite on the screen
+    uint8_t          y;      // the vertical coordinate of the sprite on the screen
+    uint8_t          width;  // the width of the sprite
+    uint8_t          height; // the height of the sprite
+    const uint32_t * mask;   // the black pixels of each row of the sprite (one bit per pixel)
+
+    // index of the screen slices, computed at compile time
+    uint8_t    first;                // first slice overlapped by the sprite
+    uint8_t    last;                 // last slice overlapped by the sprite
+    uint32_t   slices;               // slices overlapped by the sprite (one bit per slice)
+    SpriteBand bands[SpriteMaxSpan]; // rows of the sprite on each of these slices
+
+    constexpr Sprite(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint32_t * mask) :
+        Sprite(x, y, width, height, mask, SpriteSequence<SpriteMaxSpan>::type())
+        {}
+
+    template <uint8_t... I>
+    constexpr Sprite(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint32_t * mask, SpriteIndices<I...>) :
+        x(x),
+        y(y),
+        width(width),
+        height(height),
+        mask(mask),
+        first(firstSlice(y)),
+        last(lastSlice(y, height)),
+        slices(slicesOf(y, height)),
+        bands { bandOf(y, height, I)... }
+        {}
 };
 
+// loads the sprite tables generated from the spritesheet
+#include "spritesheet.h"
+
 // -------------------------------------------------------------------------
 // Game indicators
 // -------------------------------------------------------------------------
@@ -49,51 +129,6 @@ constexpr uint8_t InfoGameA = 0;
 constexpr uint8_t InfoGameB = 1;
 constexpr uint8_t InfoMiss  = 2;
 
-constexpr Sprite infoSprite[] = {
-    {  92,  3, 23, 5, 0x0000 }, // InfoGameA
-    {  92, 13, 23, 5, 0x0000 }, // InfoGameB
-    { 108, 23, 15, 5, 0x0000 }  // InfoMiss
-};
-
-constexpr Sprite headSprite[] = {
-    { 126, 20, 9, 11, 0x0000 },
-    { 136, 20, 9, 11, 0x0000 },
-    { 146, 20, 9, 11, 0x0000 }
-};
-
-// -------------------------------------------------------------------------
-// Papa's captivity
-// -------------------------------------------------------------------------
-
-constexpr Sprite marioSprite = { 5, 49, 13, 19, 0x1f00 };
-
-constexpr Sprite keySprite[] = {
-    { 51, 11,  6, 20, 0xe0fe },
-    { 58,  9,  5, 22, 0xe0fe },
-    { 62, 11,  8, 17, 0x60fe },
-    { 65,  9, 13, 14, 0x40fc }
-};
-
-constexpr Sprite cageSprite[] = {
-    { 18,  3, 12, 18, 0x1f00 },
-    {  3,  3, 12, 18, 0x1f00 },
-    {  3, 24, 12, 17, 0x0000 },
-    { 18, 24, 19, 17, 0x1f00 }
-};
-
-constexpr Sprite smileSprite = { 12, 15, 9, 8, 0x0000 };
-
-// -------------------------------------------------------------------------
-// Fruit
-// -------------------------------------------------------------------------
-
-constexpr Sprite fruitSprite[] = {
-    { 83,  29, 9, 11, 0xe007 },
-    { 83,  45, 7, 19, 0xe007 },
-    { 82,  78, 9, 16, 0xe007 },
-    { 81, 101, 9, 12, 0xe007 }
-};
-
 // -------------------------------------------------------------------------
 // Junior
 // -------------------------------------------------------------------------
@@ -128,162 +163,74 @@ constexpr int8_t ComeDown    = 23;
 constexpr int8_t Fall1       = 24;
 constexpr int8_t Fall2       = 25;
 
-constexpr Sprite juniorSprite[] = {
-    {  17, 102, 19, 21, 0x0000 }, // Bottom1,
-    {  42, 104, 18, 19, 0x0000 }, // Bottom2,
-    {  62, 103, 20, 20, 0x0000 }, // Bottom3,
-    {  87, 103, 19, 20, 0x0000 }, // Bottom4,
-    { 109, 104, 21, 19, 0x0000 }, // Bottom5,
-    { 130, 104, 18, 19, 0x0000 }, // Bottom6,
-    {  20,  84, 16, 19, 0x3f8a }, // BottomJump1
-    {  42,  85, 19, 20, 0x3f8a }, // BottomJump2
-    {  67,  84, 13, 19, 0x0000 }, // BottomJump3
-    {  91,  85, 13, 18, 0x0000 }, // BottomJump4
-    { 110,  83, 18, 21, 0x0000 }, // BottomJump5
-    { 132,  82, 18, 21, 0x0000 }, // BottomJump6
-    { 131,  56, 19, 19, 0x0000 }, // Top1,
-    { 108,  56, 20, 19, 0x0000 }, // Top2,
-    {  88,  55, 19, 20, 0x0000 }, // Top3,
-    {  66,  53, 18, 21, 0x0000 }, // Top4,
-    { 113,  38, 13, 19, 0x3f8a }, // TopJump1,
-    {  89,  35, 19, 21, 0x3f8a }, // TopJump2,
-    {  67,  35, 20, 17, 0x0000 }, // TopJump3,
-    {  50,  30, 19, 29, 0x3f8a }, // GrabKey,
-    {  37,  14, 12, 22, 0x3f8a }, // Unlock,
-    {  44,   2, 10, 18, 0x0000 }, // ArmUp,
-    {  32,  14,  7, 13, 0x0000 }, // ArmDown,
-    {  32,  37, 20, 27, 0x0000 }, // ComeDown,
-    {  11,  63, 24, 24, 0x0000 }, // Fall1,
-    {   2,  90, 13, 26, 0x0000 }  // Fall2
-};
-
 // -------------------------------------------------------------------------
-// Here are precisely the directional tables that will determine the
-// avatar's movements.
+// Here is the graph of the avatar's postures, which determines his
+// movements. Each posture has its own row, which gives:
+//
+// - the posture reached in each direction (or `Forbidden`)
+// - the position of the snapjaw, then of the bird, that bites Junior if he
+//   moves to the left or to the right (or -1)
+// - the position of the snapjaw that Junior is rewarded for dodging when
+//   he jumps over it from the posture below (or -1)
+//
+// All the other tables describing the postures are derived from this one,
+// and checked at compile time.
 // -------------------------------------------------------------------------
 
-constexpr int8_t moveLeft[] = {
-//  to:             from:
-    Forbidden,   // Bottom1
-    Bottom1,     // Bottom2
-    Bottom2,     // Bottom3
-    Bottom3,     // Bottom4
-    Bottom4,     // Bottom5
-    Bottom5,     // Bottom6
-    Forbidden,   // BottomJump1
-    Forbidden,   // BottomJump2
-    BottomJump2, // BottomJump3
-    BottomJump3, // BottomJump4
-    Forbidden,   // BottomJump5
-    Forbidden,   // BottomJump6
-    Top2,        // Top1
-    Top3,        // Top2
-    Top4,        // Top3
-    Forbidden,   // Top4
-    Forbidden,   // TopJump1
-    Forbidden,   // TopJump2
-    Forbidden    // TopJump3
+enum class Direction : uint8_t {
+    Left,
+    Right,
+    Up,
+    Down,
+    None
 };
 
-constexpr int8_t moveRight[] = {
-//  to:             from:
-    Bottom2,     // Bottom1
-    Bottom3,     // Bottom2
-    Bottom4,     // Bottom3
-    Bottom5,     // Bottom4
-    Bottom6,     // Bottom5
-    Forbidden,   // Bottom6
-    BottomJump2, // BottomJump1
-    Forbidden,   // BottomJump2
-    BottomJump4, // BottomJump3
-    BottomJump5, // BottomJump4
-    Forbidden,   // BottomJump5
-    Forbidden,   // BottomJump6
-    Forbidden,   // Top1
-    Top1,        // Top2
-    Top2,        // Top3
-    Top3,        // Top4
-    Forbidden,   // TopJump1
-    Forbidden,   // TopJump2
-    Forbidden    // TopJump3
+struct Posture {
+    int8_t to[4];      // posture reached in each direction
+    int8_t crocLeft;   // position of the snapjaw that bites Junior if he moves to the left
+    int8_t crocRight;  // position of the snapjaw that bites Junior if he moves to the right
+    int8_t birdLeft;   // position of the bird that bites Junior if he moves to the left
+    int8_t birdRight;  // position of the bird that bites Junior if he moves to the right
+    int8_t dodgedCroc; // position of the snapjaw that Junior is rewarded for dodging
 };
 
-constexpr int8_t moveUp[] = {
-//  to:             from:
-    BottomJump1, // Bottom1
-    BottomJump2, // Bottom2
-    BottomJump3, // Bottom3
-    BottomJump4, // Bottom4
-    BottomJump5, // Bottom5
-    BottomJump6, // Bottom6
-    Forbidden,   // BottomJump1
-    Forbidden,   // BottomJump2
-    Forbidden,   // BottomJump3
-    Forbidden,   // BottomJump4
-    Forbidden,   // BottomJump5
-    Top1,        // BottomJump6
-    Forbidden,   // Top1
-    TopJump1,    // Top2
-    TopJump2,    // Top3
-    TopJump3,    // Top4
-    Forbidden,   // TopJump1
-    Forbidden,   // TopJump2
-    Forbidden    // TopJump3
+constexpr uint8_t Postures = Fall2 + 1;
+
+constexpr Posture postures[] = {
+//      left         right        up           down           crocs   birds   dodged
+//                                                            L   R   L   R
+    { { Forbidden,   Bottom2,     BottomJump1, Forbidden   }, -1, 11, -1, -1, -1 }, // Bottom1
+    { { Bottom1,     Bottom3,     BottomJump2, Forbidden   }, 11, 10, -1, -1, -1 }, // Bottom2
+    { { Bottom2,     Bottom4,     BottomJump3, Forbidden   }, 10,  9, -1, -1, -1 }, // Bottom3
+    { { Bottom3,     Bottom5,     BottomJump4, Forbidden   },  9,  8, -1, -1, -1 }, // Bottom4
+    { { Bottom4,     Bottom6,     BottomJump5, Forbidden   },  8,  7, -1, -1, -1 }, // Bottom5
+    { { Bottom5,     Forbidden,   BottomJump6, Forbidden   },  7, -1, -1, -1, -1 }, // Bottom6
+    { { Forbidden,   BottomJump2, Forbidden,   Bottom1     }, -1, -1, -1,  2, -1 }, // BottomJump1
+    { { Forbidden,   Forbidden,   Forbidden,   Bottom2     }, -1, -1,  2,  3, 10 }, // BottomJump2
+    { { BottomJump2, BottomJump4, Forbidden,   Bottom3     }, -1, -1,  3,  4, -1 }, // BottomJump3
+    { { BottomJump3, BottomJump5, Forbidden,   Bottom4     }, -1, -1,  4,  5, -1 }, // BottomJump4
+    { { Forbidden,   Forbidden,   Forbidden,   Bottom5     }, -1, -1,  5,  6,  7 }, // BottomJump5
+    { { Forbidden,   Forbidden,   Top1,        Bottom6     }, -1, -1,  6, -1, -1 }, // BottomJump6
+    { { Top2,        Forbidden,   Forbidden,   BottomJump6 },  4, -1, -1, -1, -1 }, // Top1
+    { { Top3,        Top1,        TopJump1,    Forbidden   },  3,  4, -1, -1, -1 }, // Top2
+    { { Top4,        Top2,        TopJump2,    Forbidden   },  2,  3, -1, -1, -1 }, // Top3
+    { { Forbidden,   Top3,        TopJump3,    Forbidden   }, -1,  2, -1, -1, -1 }, // Top4
+    { { Forbidden,   Forbidden,   Forbidden,   Top2        }, -1, -1, -1, -1, -1 }, // TopJump1
+    { { Forbidden,   Forbidden,   Forbidden,   Top3        }, -1, -1, -1, -1,  2 }, // TopJump2
+    { { Forbidden,   Forbidden,   Forbidden,   Top4        }, -1, -1, -1, -1,  1 }, // TopJump3
+    { { Forbidden,   Forbidden,   Forbidden,   Forbidden   }, -1, -1, -1, -1, -1 }, // GrabKey
+    { { Forbidden,   Forbidden,   Forbidden,   Forbidden   }, -1, -1, -1, -1, -1 }, // Unlock
+    { { Forbidden,   Forbidden,   Forbidden,   Forbidden   }, -1, -1, -1, -1, -1 }, // ArmUp
+    { { Forbidden,   Forbidden,   Forbidden,   Forbidden   }, -1, -1, -1, -1, -1 }, // ArmDown
+    { { Forbidden,   Forbidden,   Forbidden,   Forbidden   }, -1, -1, -1, -1, -1 }, // ComeDown
+    { { Forbidden,   Forbidden,   Forbidden,   Forbidden   }, -1, -1, -1, -1, -1 }, // Fall1
+    { { Forbidden,   Forbidden,   Forbidden,   Forbidden   }, -1, -1, -1, -1, -1 }  // Fall2
 };
 
-constexpr int8_t moveDown[] = {
-//  to:             from:
-    Forbidden,   // Bottom1
-    Forbidden,   // Bottom2
-    Forbidden,   // Bottom3
-    Forbidden,   // Bottom4
-    Forbidden,   // Bottom5
-    Forbidden,   // Bottom6
-    Bottom1,     // BottomJump1
-    Bottom2,     // BottomJump2
-    Bottom3,     // BottomJump3
-    Bottom4,     // BottomJump4
-    Bottom5,     // BottomJump5
-    Bottom6,     // BottomJump6
-    BottomJump6, // Top1
-    Forbidden,   // Top2
-    Forbidden,   // Top3
-    Forbidden,   // Top4
-    Top2,        // TopJump1
-    Top3,        // TopJump2
-    Top4         // TopJump3
-};
-
-// -------------------------------------------------------------------------
-// Creatures
-// -------------------------------------------------------------------------
-
-constexpr Sprite crocSprite[] = {
-    {  38,  66, 10, 10, 0x00f8 },
-    {  57,  67,  8, 10, 0x00f8 },
-    {  80,  66, 10,  9, 0x00f8 },
-    { 103,  67,  9,  8, 0x00f8 },
-    { 124,  66, 10,  9, 0x00f8 },
-    { 148,  66,  8, 11, 0x00f8 },
-    { 145, 106, 11, 18, 0x00f8 },
-    { 123, 115, 10,  8, 0x00f8 },
-    { 104, 114, 10,  9, 0x00f8 },
-    {  81, 115, 10,  8, 0x00f8 },
-    {  57, 114, 10,  9, 0x00f8 },
-    {  35, 115, 10,  8, 0x00f8 },
-    {  12, 116, 11,  7, 0x00f8 }
-};
-
-constexpr Sprite birdSprite[] = {
-    {   2, 74,  8, 12, 0x00f8 },
-    {  13, 88, 11,  9, 0x00f8 },
-    {  35, 88, 11,  9, 0x00f8 },
-    {  58, 92, 11,  9, 0x00f8 },
-    {  81, 91, 10, 10, 0x00f8 },
-    { 104, 91, 10,  8, 0x00f8 },
-    { 125, 88, 10,  9, 0x00f8 },
-    { 147, 80, 11, 10, 0x00f8 }
-};
+// gives the posture reached from another one in a direction
+constexpr int8_t nextPosture(int8_t posture, Direction direction) {
+    return direction == Direction::None ? Forbidden : postures[posture].to[(uint8_t)direction];
+}
 
 // -------------------------------------------------------------------------
 // We define here which are the postures of the player's avatar that put him
@@ -319,92 +266,135 @@ constexpr int8_t bittenByBird[] = {
     Forbidden    //     i = 7
 };
 
-constexpr int8_t bittenByCrocWhenMoveLeft[] = {
-    -1, // Bottom1
-    11, // Bottom2
-    10, // Bottom3
-     9, // Bottom4
-     8, // Bottom5
-     7, // Bottom6
-    -1, // BottomJump1
-    -1, // BottomJump2
-    -1, // BottomJump3
-    -1, // BottomJump4
-    -1, // BottomJump5
-    -1, // BottomJump6
-     4, // Top1
-     3, // Top2
-     2, // Top3
-    -1, // Top4
-    -1, // TopJump1
-    -1, // TopJump2
-    -1  // TopJump3
-};
+// -------------------------------------------------------------------------
+// All the tables above, gathered by posture of the avatar and computed at
+// compile time. Each set of positions has one bit per position of the
+// enemies' path, so that a whole path can be checked with a single AND.
+// -------------------------------------------------------------------------
 
-constexpr int8_t bittenByCrocWhenMoveRight[] = {
-    11, // Bottom1
-    10, // Bottom2
-     9, // Bottom3
-     8, // Bottom4
-     7, // Bottom5
-    -1, // Bottom6
-    -1, // BottomJump1
-    -1, // BottomJump2
-    -1, // BottomJump3
-    -1, // BottomJump4
-    -1, // BottomJump5
-    -1, // BottomJump6
-    -1, // Top1
-     4, // Top2
-     3, // Top3
-     2, // Top4
-    -1, // TopJump1
-    -1, // TopJump2
-    -1  // TopJump3
+struct Collision {
+    uint16_t crocs;       // positions of the snapjaws that bite Junior when they move
+    uint16_t crocsLeft;   // positions of the snapjaws that bite Junior if he moves to the left
+    uint16_t crocsRight;  // positions of the snapjaws that bite Junior if he moves to the right
+    uint16_t dodgedCrocs; // positions of the snapjaws that Junior is rewarded for dodging
+    uint8_t  birds;       // positions of the birds that bite Junior when they move
+    uint8_t  birdsLeft;   // positions of the birds that bite Junior if he moves to the left
+    uint8_t  birdsRight;  // positions of the birds that bite Junior if he moves to the right
+    int8_t   jumpedFrom;  // posture from which Junior must have jumped to be rewarded
 };
 
-constexpr int8_t bittenByBirdWhenMoveLeft[] = {
-    -1, // Bottom1
-    -1, // Bottom2
-    -1, // Bottom3
-    -1, // Bottom4
-    -1, // Bottom5
-    -1, // Bottom6
-    -1, // BottomJump1
-     2, // BottomJump2
-     3, // BottomJump3
-     4, // BottomJump4
-     5, // BottomJump5
-     6, // BottomJump6
-    -1, // Top1
-    -1, // Top2
-    -1, // Top3
-    -1, // Top4
-    -1, // TopJump1
-    -1, // TopJump2
-    -1  // TopJump3
+// positions of a path at which the table gives the posture
+constexpr uint16_t positionsOf(const int8_t * bittenBy, uint8_t size, int8_t posture) {
+    return size == 0 ? 0 : (bittenBy[size - 1] == posture ? 1 << (size - 1) : 0) | positionsOf(bittenBy, size - 1, posture);
+}
+
+// a single position of a path, as a set of positions
+constexpr uint16_t positionAt(int8_t position) {
+    return position == -1 ? 0 : 1 << position;
+}
+
+constexpr Collision collision(int8_t posture) {
+    return {
+        positionsOf(bittenByCroc, sizeof(bittenByCroc), posture),
+        positionAt(postures[posture].crocLeft),
+        positionAt(postures[posture].crocRight),
+        positionAt(postures[posture].dodgedCroc),
+        (uint8_t)positionsOf(bittenByBird, sizeof(bittenByBird), posture),
+        (uint8_t)positionAt(postures[posture].birdLeft),
+        (uint8_t)positionAt(postures[posture].birdRight),
+        nextPosture(posture, Direction::Down)
+    };
+}
+
+constexpr Collision collisions[] = {
+    collision(Bottom1),
+    collision(Bottom2),
+    collision(Bottom3),
+    collision(Bottom4),
+    collision(Bottom5),
+    collision(Bottom6),
+    collision(BottomJump1),
+    collision(BottomJump2),
+    collision(BottomJump3),
+    collision(BottomJump4),
+    collision(BottomJump5),
+    collision(BottomJump6),
+    collision(Top1),
+    collision(Top2),
+    collision(Top3),
+    collision(Top4),
+    collision(TopJump1),
+    collision(TopJump2),
+    collision(TopJump3),
+    collision(GrabKey),
+    collision(Unlock),
+    collision(ArmUp),
+    collision(ArmDown),
+    collision(ComeDown),
+    collision(Fall1),
+    collision(Fall2)
 };
 
-constexpr int8_t bittenByBirdWhenMoveRight[] = {
-    -1, // Bottom1
-    -1, // Bottom2
-    -1, // Bottom3
-    -1, // Bottom4
-    -1, // Bottom5
-    -1, // Bottom6
-     2, // BottomJump1
-     3, // BottomJump2
-     4, // BottomJump3
-     5, // BottomJump4
-     6, // BottomJump5
-    -1, // BottomJump6
-    -1, // Top1
-    -1, // Top2
-    -1, // Top3
-    -1, // Top4
-    -1, // TopJump1
-    -1, // TopJump2
-    -1  // TopJump3
-};
+// -------------------------------------------------------------------------
+// Compile-time checks
+// -------------------------------------------------------------------------
+
+// a posture is either forbidden or one of the known postures
+constexpr bool isPosture(int8_t posture) {
+    return posture == Forbidden || (posture >= 0 && posture < Postures);
+}
+
+// a position is either missing or on the path of the enemies
+constexpr bool isPosition(int8_t position, uint8_t size) {
+    return position == -1 || (position >= 0 && position < size);
+}
+
+constexpr bool isValid(const Posture & row) {
+    return isPosture(row.to[0]) && isPosture(row.to[1]) && isPosture(row.to[2]) && isPosture(row.to[3])
+        && isPosition(row.crocLeft,   sizeof(bittenByCroc))
+        && isPosition(row.crocRight,  sizeof(bittenByCroc))
+        && isPosition(row.birdLeft,   sizeof(bittenByBird))
+        && isPosition(row.birdRight,  sizeof(bittenByBird))
+        && isPosition(row.dodgedCroc, sizeof(bittenByCroc));
+}
+
+constexpr bool isValid(uint8_t posture = 0) {
+    return posture == Postures || (isValid(postures[posture]) && isValid(posture + 1));
+}
+
+// the enemies bite Junior in known postures only
+constexpr bool isBiting(const int8_t * bittenBy, uint8_t size) {
+    return size == 0 || (isPosture(bittenBy[size - 1]) && isBiting(bittenBy, size - 1));
+}
+
+// the bands of a sprite cover all its rows, from top to bottom (the bands
+// beyond its last slice being empty), it is small enough to fit in the
+// slices that have been set aside for it, and its rows fit in a mask
+constexpr bool isIndexed(const Sprite & sprite, uint8_t n = 0, uint8_t row = 0) {
+    return n == SpriteMaxSpan
+        ? row == sprite.height && sprite.height <= SpriteMaxHeight && sprite.width <= SpriteMaxWidth
+        : (sprite.bands[n].rows == 0 || sprite.bands[n].mask == row) && isIndexed(sprite, n + 1, row + sprite.bands[n].rows);
+}
+
+constexpr bool isIndexed(const Sprite * sprites, uint8_t size) {
+    return size == 0 || (isIndexed(sprites[size - 1]) && isIndexed(sprites, size - 1));
+}
+
+static_assert(sizeof(postures) / sizeof(postures[0]) == Postures, "one row per posture in the posture graph");
+static_assert(isValid(), "the posture graph leads to unknown postures or positions");
+static_assert(isBiting(bittenByCroc, sizeof(bittenByCroc)), "the snapjaws bite Junior in unknown postures");
+static_assert(isBiting(bittenByBird, sizeof(bittenByBird)), "the birds bite Junior in unknown postures");
+static_assert(sizeof(collisions) / sizeof(collisions[0]) == Postures, "one set of collisions per posture");
+
+static_assert(isIndexed(infoSprite,   sizeof(infoSprite)   / sizeof(Sprite)), "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(headSprite,   sizeof(headSprite)   / sizeof(Sprite)), "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(&marioSprite, 1),                                     "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(keySprite,    sizeof(keySprite)    / sizeof(Sprite)), "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(cageSprite,   sizeof(cageSprite)   / sizeof(Sprite)), "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(&smileSprite, 1),                                     "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(fruitSprite,  sizeof(fruitSprite)  / sizeof(Sprite)), "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(juniorSprite, sizeof(juniorSprite) / sizeof(Sprite)), "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(crocSprite,   sizeof(crocSprite)   / sizeof(Sprite)), "the slice index of the sprites is inconsistent");
+static_assert(isIndexed(birdSprite,   sizeof(birdSprite)   / sizeof(Sprite)), "the slice index of the sprites is inconsistent");
 
 #endif
\ No newline at end of file
@@ -0,0 +1,512 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                               Sprite Masks
+// -------------------------------------------------------------------------
+// This file is generated by the asset compiler (`tools/assets.cpp`) from
+// the images of the `assets` folder: do not edit it by hand.
+//
+// Each row of a sprite is packed into a 32-bit word, one bit per pixel: the
+// least significant bit corresponds to the leftmost pixel of the sprite.
+// -------------------------------------------------------------------------
+
+#ifndef DONKEY_KONG_JR_SPRITESHEET
+#define DONKEY_KONG_JR_SPRITESHEET
+
+constexpr uint32_t infoSpriteMask0[] = {
+    0x0021d126, 0x00505b51, 0x0070d575, 0x00505155, 0x0051d156
+};
+
+constexpr uint32_t infoSpriteMask1[] = {
+    0x0031d126, 0x00505b51, 0x0030d575, 0x00505155, 0x0031d156
+};
+
+constexpr uint32_t infoSpriteMask2[] = {
+    0x00006651, 0x0000115b, 0x00002255, 0x00004451, 0x00003351
+};
+
+constexpr Sprite infoSprite[] = {
+    {  92,   3, 23,  5, infoSpriteMask0 }, // InfoGameA
+    {  92,  13, 23,  5, infoSpriteMask1 }, // InfoGameB
+    { 108,  23, 15,  5, infoSpriteMask2 } // InfoMiss
+};
+
+constexpr uint32_t headSpriteMask0[] = {
+    0x00000030, 0x00000078, 0x000000e4, 0x000001ec, 0x000001e2, 0x00000131,
+    0x00000141, 0x0000018f, 0x00000192, 0x00000084, 0x00000078
+};
+
+constexpr uint32_t headSpriteMask1[] = {
+    0x00000030, 0x00000078, 0x000000e4, 0x000001ec, 0x000001e2, 0x00000131,
+    0x00000141, 0x0000018f, 0x00000192, 0x00000084, 0x00000078
+};
+
+constexpr uint32_t headSpriteMask2[] = {
+    0x00000030, 0x00000078, 0x000000e4, 0x000001ec, 0x000001e2, 0x00000131,
+    0x00000141, 0x0000018f, 0x00000192, 0x00000084, 0x00000078
+};
+
+constexpr Sprite headSprite[] = {
+    { 126,  20,  9, 11, headSpriteMask0 },
+    { 136,  20,  9, 11, headSpriteMask1 },
+    { 146,  20,  9, 11, headSpriteMask2 }
+};
+
+constexpr uint32_t marioSpriteMask[] = {
+    0x000001f0, 0x0000010e, 0x00000382, 0x00000202, 0x000001fe, 0x0000035f,
+    0x00000017, 0x000003c6, 0x000001c4, 0x00000088, 0x000000fc, 0x000000fc,
+    0x00000174, 0x00001f52, 0x00001a52, 0x00001e72, 0x00000f02, 0x00000fc4,
+    0x00000078
+};
+
+constexpr Sprite marioSprite = {   5,  49, 13, 19, marioSpriteMask };
+
+constexpr uint32_t keySpriteMask0[] = {
+    0x00000020, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000008,
+    0x00000008, 0x00000000, 0x0000000c, 0x0000000a, 0x00000011, 0x00000012,
+    0x0000000e, 0x00000006, 0x00000002, 0x00000002, 0x00000007, 0x00000007,
+    0x00000003, 0x00000001
+};
+
+constexpr uint32_t keySpriteMask1[] = {
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000000, 0x00000006, 0x00000009,
+    0x00000009, 0x00000006, 0x00000006, 0x00000004, 0x00000004, 0x00000004,
+    0x0000000c, 0x0000001c, 0x0000001c, 0x00000004
+};
+
+constexpr uint32_t keySpriteMask2[] = {
+    0x00000001, 0x00000001, 0x00000002, 0x00000002, 0x00000004, 0x00000000,
+    0x0000001c, 0x00000024, 0x00000024, 0x0000001c, 0x00000010, 0x00000030,
+    0x00000020, 0x000000e0, 0x000000e0, 0x000000c0, 0x00000040
+};
+
+constexpr uint32_t keySpriteMask3[] = {
+    0x00000001, 0x00000002, 0x00000004, 0x00000008, 0x00000070, 0x00000090,
+    0x000000d0, 0x000000f0, 0x000000c0, 0x00000100, 0x00000a00, 0x00001c00,
+    0x00001c00, 0x00000800
+};
+
+constexpr Sprite keySprite[] = {
+    {  51,  11,  6, 20, keySpriteMask0 },
+    {  58,   9,  5, 22, keySpriteMask1 },
+    {  62,  11,  8, 17, keySpriteMask2 },
+    {  65,   9, 13, 14, keySpriteMask3 }
+};
+
+constexpr uint32_t cageSpriteMask0[] = {
+    0x000007ff, 0x00000fff, 0x00000842, 0x00000842, 0x00000842, 0x00000842,
+    0x00000840, 0x00000840, 0x00000840, 0x00000840, 0x00000840, 0x00000840,
+    0x00000840, 0x00000840, 0x00000840, 0x00000840, 0x00000840, 0x00000840
+};
+
+constexpr uint32_t cageSpriteMask1[] = {
+    0x00000ffe, 0x00000fff, 0x00000421, 0x00000421, 0x00000421, 0x00000421,
+    0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021,
+    0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021
+};
+
+constexpr uint32_t cageSpriteMask2[] = {
+    0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000421,
+    0x00000421, 0x00000421, 0x00000421, 0x00000421, 0x00000421, 0x00000421,
+    0x00000421, 0x00000421, 0x00000421, 0x00000fff, 0x00000ffe
+};
+
+constexpr uint32_t cageSpriteMask3[] = {
+    0x00000840, 0x00000840, 0x00000840, 0x00000840, 0x00000840, 0x0003f842,
+    0x00073842, 0x00061842, 0x00061842, 0x00073842, 0x00073842, 0x00061842,
+    0x00061842, 0x0007f842, 0x0003f842, 0x00000fff, 0x000007ff
+};
+
+constexpr Sprite cageSprite[] = {
+    {  18,   3, 12, 18, cageSpriteMask0 },
+    {   3,   3, 12, 18, cageSpriteMask1 },
+    {   3,  24, 12, 17, cageSpriteMask2 },
+    {  18,  24, 19, 17, cageSpriteMask3 }
+};
+
+constexpr uint32_t smileSpriteMask[] = {
+    0x00000101, 0x000001ff, 0x00000103, 0x000001ff, 0x000001ff, 0x000001fe,
+    0x000000cc, 0x00000030
+};
+
+constexpr Sprite smileSprite = {  12,  15,  9,  8, smileSpriteMask };
+
+constexpr uint32_t fruitSpriteMask0[] = {
+    0x00000004, 0x00000078, 0x0000009c, 0x0000012e, 0x0000009b, 0x00000079,
+    0x0000003d, 0x0000003f, 0x0000003e, 0x0000003c, 0x00000018
+};
+
+constexpr uint32_t fruitSpriteMask1[] = {
+    0x00000008, 0x00000028, 0x00000028, 0x00000020, 0x00000020, 0x00000020,
+    0x00000020, 0x00000000, 0x0000001a, 0x0000002c, 0x00000044, 0x0000002e,
+    0x0000003b, 0x00000039, 0x0000003d, 0x0000003f, 0x0000003e, 0x0000003c,
+    0x00000018
+};
+
+constexpr uint32_t fruitSpriteMask2[] = {
+    0x00000010, 0x00000050, 0x00000050, 0x00000040, 0x00000040, 0x0000005c,
+    0x00000012, 0x00000012, 0x0000003f, 0x0000007e, 0x000000fa, 0x000000f6,
+    0x000001fc, 0x000001f8, 0x000000e0
+};
+
+constexpr uint32_t fruitSpriteMask3[] = {
+    0x00000020, 0x000000a0, 0x000000a0, 0x00000080, 0x0000008c, 0x00000012,
+    0x00000032, 0x0000007e, 0x000000ff, 0x000001fe, 0x000001e6, 0x000000fc
+};
+
+constexpr Sprite fruitSprite[] = {
+    {  83,  29,  9, 11, fruitSpriteMask0 },
+    {  83,  45,  7, 19, fruitSpriteMask1 },
+    {  82,  78,  9, 15, fruitSpriteMask2 },
+    {  81, 101,  9, 12, fruitSpriteMask3 }
+};
+
+constexpr uint32_t juniorSpriteMask0[] = {
+    0x00001e00, 0x00003f18, 0x000055e4, 0x0000a164, 0x00007968, 0x000084e4,
+    0x0000bcdc, 0x00007980, 0x000023c0, 0x00003e76, 0x0003f079, 0x0004f831,
+    0x0005f832, 0x00046872, 0x00024ccc, 0x00039f80, 0x00001e00, 0x00000f00,
+    0x00000880, 0x00001180, 0x00001e00
+};
+
+constexpr uint32_t juniorSpriteMask1[] = {
+    0x000001e0, 0x00000350, 0x00004ee8, 0x0000aa08, 0x00011b68, 0x00009e04,
+    0x00009c64, 0x00007494, 0x00001208, 0x000391fe, 0x00027079, 0x00027051,
+    0x00017096, 0x00013398, 0x0000cfc0, 0x000003e0, 0x000001e0, 0x00000210,
+    0x000003f0
+};
+
+constexpr uint32_t juniorSpriteMask2[] = {
+    0x00000018, 0x00000024, 0x000078e8, 0x0000dfe8, 0x00018de4, 0x0000a5dc,
+    0x0000c380, 0x0000898c, 0x0002b5b2, 0x0005c9f1, 0x0009b272, 0x0008fc72,
+    0x0004f034, 0x00031028, 0x00000c40, 0x00001f80, 0x00001e00, 0x00001f00,
+    0x00002100, 0x00003f00
+};
+
+constexpr uint32_t juniorSpriteMask3[] = {
+    0x00018000, 0x00014380, 0x00024740, 0x00027630, 0x00017cf0, 0x000174a8,
+    0x00019808, 0x00001b08, 0x00000a90, 0x0000d5d0, 0x0001e438, 0x0001e3fe,
+    0x0003e0b1, 0x00056321, 0x0004672e, 0x00079f90, 0x00000f80, 0x00000780,
+    0x00000840, 0x00000fc0
+};
+
+constexpr uint32_t juniorSpriteMask4[] = {
+    0x00000018, 0x00007064, 0x0000fee4, 0x00008bc8, 0x00012ff2, 0x0001a385,
+    0x000f4189, 0x00139999, 0x0011a3f9, 0x000ac27a, 0x000c4c7c, 0x00003020,
+    0x00001040, 0x00000f80, 0x00001f00, 0x00001e00, 0x00000f00, 0x00001080,
+    0x00001f80
+};
+
+constexpr uint32_t juniorSpriteMask5[] = {
+    0x000000f0, 0x000061f8, 0x00005384, 0x00004dac, 0x00002d12, 0x00005f02,
+    0x00002e3a, 0x00018e46, 0x0002593c, 0x000270f8, 0x000270fe, 0x000171d1,
+    0x00015395, 0x00008f9a, 0x000007c0, 0x000003c0, 0x000003c0, 0x00000420,
+    0x000007e0
+};
+
+constexpr uint32_t juniorSpriteMask6[] = {
+    0x000003c0, 0x00000720, 0x000076b0, 0x0000aef8, 0x00009a08, 0x00004c08,
+    0x0000b9f8, 0x000099e0, 0x00009c10, 0x00007fe0, 0x00000fe0, 0x00000470,
+    0x0000043e, 0x00001c39, 0x0000fe71, 0x00009ff2, 0x00005814, 0x00002808,
+    0x00001000
+};
+
+constexpr uint32_t juniorSpriteMask7[] = {
+    0x00020000, 0x00050704, 0x00050f8a, 0x000498d1, 0x0005e572, 0x0005f734,
+    0x0006e8f2, 0x0000702e, 0x00002020, 0x00002720, 0x00001fc0, 0x000018c0,
+    0x00007770, 0x0000f07e, 0x0000f079, 0x000078f1, 0x0000ff12, 0x0001081c,
+    0x00013000, 0x0001c000
+};
+
+constexpr uint32_t juniorSpriteMask8[] = {
+    0x00000078, 0x000000fc, 0x00000e84, 0x00001382, 0x000012ab, 0x000013bb,
+    0x00000d02, 0x00001201, 0x0000127e, 0x00001b38, 0x00000788, 0x000001f8,
+    0x00000bf8, 0x000017fe, 0x00001789, 0x00001389, 0x00000bf9, 0x00000405,
+    0x00000002
+};
+
+constexpr uint32_t juniorSpriteMask9[] = {
+    0x0000003c, 0x00000d7e, 0x00001357, 0x000009e3, 0x00000907, 0x00000b82,
+    0x00000fb2, 0x00000bcb, 0x00000be2, 0x000001fc, 0x000000bc, 0x0000079e,
+    0x00000bfe, 0x00000ffe, 0x000013fc, 0x000009f8, 0x00000480, 0x00000300
+};
+
+constexpr uint32_t juniorSpriteMask10[] = {
+    0x0000c000, 0x00012000, 0x0001201c, 0x0000b822, 0x0000bfe2, 0x0000f8f4,
+    0x00003772, 0x0000155c, 0x00002050, 0x00003c20, 0x00001e20, 0x00002040,
+    0x00001fc0, 0x00000c40, 0x00001c78, 0x0000fc7e, 0x00013ef1, 0x00023fb1,
+    0x00011012, 0x0000900c, 0x00006000
+};
+
+constexpr uint32_t juniorSpriteMask11[] = {
+    0x00000700, 0x00001f80, 0x000020ce, 0x00002a51, 0x00002e55, 0x00001039,
+    0x0001e732, 0x0002b932, 0x0002ff7c, 0x000030f0, 0x00007f00, 0x00000800,
+    0x00007800, 0x0001b860, 0x00011ce0, 0x00010ff0, 0x0000eef0, 0x000019e0,
+    0x000005c0, 0x00000480, 0x00000380
+};
+
+constexpr uint32_t juniorSpriteMask12[] = {
+    0x00000300, 0x00000780, 0x00018840, 0x00035ae0, 0x0004ebd0, 0x0004f05e,
+    0x0003e3f5, 0x0000e46f, 0x000067f9, 0x0000307e, 0x00003fc0, 0x00001040,
+    0x000018f0, 0x000078f0, 0x00007ff0, 0x0000f9b0, 0x0001b910, 0x000108e0,
+    0x0001f000
+};
+
+constexpr uint32_t juniorSpriteMask13[] = {
+    0x00000180, 0x000303c0, 0x00048720, 0x0004ff10, 0x0004f6b0, 0x0006fcf0,
+    0x00013810, 0x00043b0e, 0x000a3b95, 0x0009e9f1, 0x0009e632, 0x0005e1ec,
+    0x00036080, 0x00002100, 0x00001f00, 0x00000f80, 0x00000fc0, 0x00000820,
+    0x000007e0
+};
+
+constexpr uint32_t juniorSpriteMask14[] = {
+    0x00001e00, 0x00003f08, 0x00002314, 0x00002bf4, 0x00007b64, 0x000041e8,
+    0x000081f4, 0x00009d88, 0x0000bd40, 0x0001e25b, 0x0007fc3d, 0x0004d839,
+    0x00064c3a, 0x0003ae52, 0x00005f8c, 0x00003e00, 0x00003e00, 0x00001e00,
+    0x00002100, 0x00003f00
+};
+
+constexpr uint32_t juniorSpriteMask15[] = {
+    0x0000c180, 0x000147c0, 0x00013e40, 0x00013c20, 0x00013d70, 0x00017dd0,
+    0x0001a808, 0x00003fc8, 0x0000154c, 0x0000d7fe, 0x0001703e, 0x00023ffe,
+    0x00023079, 0x000130ed, 0x000129c9, 0x0000c7ee, 0x000003e0, 0x000003c0,
+    0x000007e0, 0x00000410, 0x000007f0
+};
+
+constexpr uint32_t juniorSpriteMask16[] = {
+    0x00000018, 0x0000003c, 0x00000e62, 0x000011c3, 0x00001156, 0x00000ddf,
+    0x00001381, 0x00001301, 0x00001340, 0x00000fe2, 0x000003fe, 0x0000009e,
+    0x0000009e, 0x000001fe, 0x000003fe, 0x000004fc, 0x00000258, 0x00000160,
+    0x000000c0
+};
+
+constexpr uint32_t juniorSpriteMask17[] = {
+    0x00000004, 0x0000000a, 0x00000712, 0x00000c92, 0x00001c72, 0x00001d79,
+    0x0000173f, 0x00006010, 0x000079f0, 0x0003ba30, 0x0000fbe0, 0x00029c40,
+    0x00051fd8, 0x00001864, 0x0000d854, 0x00017c44, 0x00017c88, 0x00017f88,
+    0x00017850, 0x00014020, 0x00008000
+};
+
+constexpr uint32_t juniorSpriteMask18[] = {
+    0x00000380, 0x000007c0, 0x00000c46, 0x00000ab9, 0x00001bd9, 0x0003ee3a,
+    0x0004f81a, 0x00087356, 0x000efbd0, 0x00013820, 0x000027c0, 0x00012098,
+    0x0002f0e4, 0x0004f1e4, 0x0005ffc8, 0x0005e048, 0x00020030
+};
+
+constexpr uint32_t juniorSpriteMask19[] = {
+    0x00000030, 0x00000028, 0x00000027, 0x00000011, 0x00000012, 0x000000dc,
+    0x000001fc, 0x0000039c, 0x0000032e, 0x00000742, 0x0000f70c, 0x00011c78,
+    0x00009d58, 0x0000bf5c, 0x00006774, 0x00000704, 0x00006d18, 0x00009cf0,
+    0x00008c10, 0x00004c10, 0x00003620, 0x000003c0, 0x000087c0, 0x00010b80,
+    0x00020900, 0x00042900, 0x00004a00, 0x00008a00, 0x00010400
+};
+
+constexpr uint32_t juniorSpriteMask20[] = {
+    0x00000038, 0x00000074, 0x000000c4, 0x000000de, 0x00000152, 0x00000181,
+    0x000003b9, 0x000003a7, 0x000007ba, 0x00000684, 0x00000478, 0x00000410,
+    0x00000e10, 0x00000e18, 0x00000f1c, 0x00000fbe, 0x000007fe, 0x000009bc,
+    0x000008b4, 0x00000ca4, 0x00000328, 0x00000030
+};
+
+constexpr uint32_t juniorSpriteMask21[] = {
+    0x00000008, 0x000000f0, 0x00000100, 0x00000100, 0x00000380, 0x00000260,
+    0x00000138, 0x00000164, 0x000000c2, 0x00000045, 0x0000003d, 0x0000003a,
+    0x0000001e, 0x0000001c, 0x0000001c, 0x00000018, 0x00000018, 0x00000010
+};
+
+constexpr uint32_t juniorSpriteMask22[] = {
+    0x00000004, 0x0000000a, 0x0000000a, 0x00000011, 0x0000000a, 0x0000000e,
+    0x00000009, 0x00000009, 0x00000009, 0x00000016, 0x00000031, 0x00000071,
+    0x0000001e
+};
+
+constexpr uint32_t juniorSpriteMask23[] = {
+    0x00004400, 0x00004400, 0x00002200, 0x00002200, 0x00002000, 0x00000000,
+    0x00000f00, 0x00001d8c, 0x00001850, 0x0007baa2, 0x0004aaa2, 0x0008401c,
+    0x0008471c, 0x0006f4f8, 0x0001f638, 0x000031f0, 0x00001c20, 0x00000fe6,
+    0x00000c19, 0x00000c18, 0x00001e19, 0x00001f3a, 0x00001fca, 0x00000f04,
+    0x00003e00, 0x00002100, 0x00001f00
+};
+
+constexpr uint32_t juniorSpriteMask24[] = {
+    0x00040000, 0x00020000, 0x00010000, 0x00008000, 0x00084000, 0x00842000,
+    0x00420600, 0x00200f00, 0x00103fcc, 0x00080632, 0x0000e612, 0x00013fb2,
+    0x00015ffe, 0x00011fe0, 0x00013de0, 0x0000dfe0, 0x0000112c, 0x00002c32,
+    0x00002a91, 0x00002a53, 0x00002a34, 0x00001e4c, 0x00000e40, 0x000007c0
+};
+
+constexpr uint32_t juniorSpriteMask25[] = {
+    0x00000020, 0x00000020, 0x00000120, 0x00000110, 0x00000090, 0x00000490,
+    0x00000480, 0x00000440, 0x00000240, 0x0000020c, 0x0000020a, 0x00000211,
+    0x00000112, 0x00000122, 0x00000024, 0x0000083c, 0x0000143c, 0x000017ec,
+    0x00001784, 0x00001704, 0x0000172c, 0x00001bfe, 0x000003fe, 0x000001ec,
+    0x00000164, 0x00000120
+};
+
+constexpr Sprite juniorSprite[] = {
+    {  17, 102, 19, 21, juniorSpriteMask0 }, // Bottom1
+    {  42, 104, 18, 19, juniorSpriteMask1 }, // Bottom2
+    {  62, 103, 20, 20, juniorSpriteMask2 }, // Bottom3
+    {  87, 103, 19, 20, juniorSpriteMask3 }, // Bottom4
+    { 109, 104, 21, 19, juniorSpriteMask4 }, // Bottom5
+    { 130, 104, 18, 19, juniorSpriteMask5 }, // Bottom6
+    {  20,  84, 16, 19, juniorSpriteMask6 }, // BottomJump1
+    {  42,  85, 19, 20, juniorSpriteMask7 }, // BottomJump2
+    {  67,  84, 13, 19, juniorSpriteMask8 }, // BottomJump3
+    {  91,  85, 13, 18, juniorSpriteMask9 }, // BottomJump4
+    { 110,  83, 18, 21, juniorSpriteMask10 }, // BottomJump5
+    { 132,  82, 18, 21, juniorSpriteMask11 }, // BottomJump6
+    { 131,  56, 19, 19, juniorSpriteMask12 }, // Top1
+    { 108,  56, 20, 19, juniorSpriteMask13 }, // Top2
+    {  88,  55, 19, 20, juniorSpriteMask14 }, // Top3
+    {  66,  53, 18, 21, juniorSpriteMask15 }, // Top4
+    { 113,  38, 13, 19, juniorSpriteMask16 }, // TopJump1
+    {  89,  35, 19, 21, juniorSpriteMask17 }, // TopJump2
+    {  67,  35, 20, 17, juniorSpriteMask18 }, // TopJump3
+    {  50,  30, 19, 29, juniorSpriteMask19 }, // GrabKey
+    {  37,  14, 12, 22, juniorSpriteMask20 }, // Unlock
+    {  44,   2, 10, 18, juniorSpriteMask21 }, // ArmUp
+    {  32,  14,  7, 13, juniorSpriteMask22 }, // ArmDown
+    {  32,  37, 20, 27, juniorSpriteMask23 }, // ComeDown
+    {  11,  63, 24, 24, juniorSpriteMask24 }, // Fall1
+    {   2,  90, 13, 26, juniorSpriteMask25 } // Fall2
+};
+
+constexpr uint32_t crocSpriteMask0[] = {
+    0x00000300, 0x00000180, 0x000002c8, 0x0000017d, 0x0000009e, 0x0000000c,
+    0x0000005c, 0x000000b0, 0x00000160, 0x000000c0
+};
+
+constexpr uint32_t crocSpriteMask1[] = {
+    0x00000080, 0x00000040, 0x000000a0, 0x0000005c, 0x0000001e, 0x00000006,
+    0x00000057, 0x000000f8
+};
+
+constexpr uint32_t crocSpriteMask2[] = {
+    0x00000020, 0x00000050, 0x00000010, 0x00000028, 0x0000000c, 0x00000016,
+    0x00000006, 0x00000157, 0x000003f8
+};
+
+constexpr uint32_t crocSpriteMask3[] = {
+    0x00000040, 0x000000a0, 0x00000050, 0x0000002e, 0x0000000f, 0x00000003,
+    0x000000ab, 0x000001fc
+};
+
+constexpr uint32_t crocSpriteMask4[] = {
+    0x00000020, 0x00000050, 0x00000010, 0x00000028, 0x0000000c, 0x00000016,
+    0x00000006, 0x00000157, 0x000003f8
+};
+
+constexpr uint32_t crocSpriteMask5[] = {
+    0x00000001, 0x00000007, 0x0000000e, 0x0000000e, 0x00000012, 0x00000022,
+    0x00000056, 0x000000a2, 0x0000004c, 0x00000004, 0x0000000c
+};
+
+constexpr uint32_t crocSpriteMask6[] = {
+    0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000500,
+    0x00000500, 0x00000500, 0x00000400, 0x00000410, 0x00000428, 0x00000020,
+    0x00000050, 0x000000c0, 0x000001a0, 0x00000580, 0x000003aa, 0x0000007f
+};
+
+constexpr uint32_t crocSpriteMask7[] = {
+    0x00000004, 0x0000000a, 0x00000014, 0x000000e8, 0x000001e0, 0x00000180,
+    0x000003aa, 0x0000007f
+};
+
+constexpr uint32_t crocSpriteMask8[] = {
+    0x00000010, 0x00000028, 0x00000020, 0x00000050, 0x000000c0, 0x000001a0,
+    0x00000180, 0x000003aa, 0x0000007f
+};
+
+constexpr uint32_t crocSpriteMask9[] = {
+    0x00000004, 0x0000000a, 0x00000014, 0x000000e8, 0x000001e0, 0x00000180,
+    0x000003aa, 0x0000007f
+};
+
+constexpr uint32_t crocSpriteMask10[] = {
+    0x00000010, 0x00000028, 0x00000020, 0x00000050, 0x000000c0, 0x000001a0,
+    0x00000180, 0x000003aa, 0x0000007f
+};
+
+constexpr uint32_t crocSpriteMask11[] = {
+    0x00000004, 0x0000000a, 0x00000014, 0x000000e8, 0x000001e0, 0x00000180,
+    0x000003aa, 0x0000007f
+};
+
+constexpr uint32_t crocSpriteMask12[] = {
+    0x00000002, 0x0000000d, 0x00000034, 0x000001d0, 0x000003aa, 0x000007fe,
+    0x00000180
+};
+
+constexpr Sprite crocSprite[] = {
+    {  38,  66, 10, 10, crocSpriteMask0 },
+    {  57,  67,  8,  8, crocSpriteMask1 },
+    {  80,  66, 10,  9, crocSpriteMask2 },
+    { 103,  67,  9,  8, crocSpriteMask3 },
+    { 124,  66, 10,  9, crocSpriteMask4 },
+    { 148,  66,  8, 11, crocSpriteMask5 },
+    { 145, 106, 11, 18, crocSpriteMask6 },
+    { 123, 115, 10,  8, crocSpriteMask7 },
+    { 104, 114, 10,  9, crocSpriteMask8 },
+    {  81, 115, 10,  8, crocSpriteMask9 },
+    {  57, 114, 10,  9, crocSpriteMask10 },
+    {  35, 115, 10,  8, crocSpriteMask11 },
+    {  12, 116, 11,  7, crocSpriteMask12 }
+};
+
+constexpr uint32_t birdSpriteMask0[] = {
+    0x00000080, 0x000000c0, 0x000000e2, 0x000000f7, 0x000000fe, 0x0000001c,
+    0x0000007c, 0x000000fc, 0x000000f0, 0x000000a0, 0x000000e0, 0x00000080
+};
+
+constexpr uint32_t birdSpriteMask1[] = {
+    0x00000002, 0x0000000f, 0x0000001e, 0x000000fc, 0x000001f8, 0x000002fc,
+    0x000007b8, 0x0000003c, 0x0000001e
+};
+
+constexpr uint32_t birdSpriteMask2[] = {
+    0x00000010, 0x00000030, 0x0000007c, 0x00000078, 0x0000003c, 0x000001f8,
+    0x000002fe, 0x0000078f, 0x00000002
+};
+
+constexpr uint32_t birdSpriteMask3[] = {
+    0x00000080, 0x000001fc, 0x000002fe, 0x000007ff, 0x00000032, 0x00000038,
+    0x0000003c, 0x00000038, 0x0000001c
+};
+
+constexpr uint32_t birdSpriteMask4[] = {
+    0x00000004, 0x0000001c, 0x0000001e, 0x0000005c, 0x000000de, 0x00000178,
+    0x000003fc, 0x0000001e, 0x00000007, 0x00000002
+};
+
+constexpr uint32_t birdSpriteMask5[] = {
+    0x00000040, 0x000000e1, 0x0000017e, 0x000003ff, 0x00000030, 0x00000038,
+    0x0000003c, 0x0000001e
+};
+
+constexpr uint32_t birdSpriteMask6[] = {
+    0x00000010, 0x0000003c, 0x00000038, 0x0000009c, 0x000000d8, 0x00000178,
+    0x000003fe, 0x0000001f, 0x00000002
+};
+
+constexpr uint32_t birdSpriteMask7[] = {
+    0x00000080, 0x00000180, 0x000002f8, 0x000007fc, 0x0000003f, 0x00000072,
+    0x000000f0, 0x000000e0, 0x000000c0, 0x00000040
+};
+
+constexpr Sprite birdSprite[] = {
+    {   2,  74,  8, 12, birdSpriteMask0 },
+    {  13,  88, 11,  9, birdSpriteMask1 },
+    {  35,  88, 11,  9, birdSpriteMask2 },
+    {  58,  92, 11,  9, birdSpriteMask3 },
+    {  81,  91, 10, 10, birdSpriteMask4 },
+    { 104,  91, 10,  8, birdSpriteMask5 },
+    { 125,  88, 10,  9, birdSpriteMask6 },
+    { 147,  80, 11, 10, birdSpriteMask7 }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                                Player Input
+// -------------------------------------------------------------------------
+
+// loads the header file of the class
+#include "Input.h"
+
+// the buttons that are used by the game
+static const Button used[] = {
+    BUTTON_DOWN,
+    BUTTON_LEFT,
+    BUTTON_RIGHT,
+    BUTTON_UP,
+    BUTTON_A,
+    BUTTON_B,
+    BUTTON_MENU
+};
+
+// constructor
+Input::Input() {
+    buttons  = 0;
+    recorder = NULL;
+    player   = NULL;
+}
+
+// starts recording the buttons (or stops it with NULL)
+void Input::record(Replay * replay) {
+    recorder = replay;
+}
+
+// starts reading the buttons from a replay (or stops it with NULL)
+void Input::play(Replay * replay) {
+    player = replay;
+}
+
+// indicates that the buttons are read from a replay
+bool Input::isPlaying() {
+    return player != NULL;
+}
+
+// reads the buttons pressed on the current frame.
+// when the buttons are not polled, none of them is considered as pressed
+void Input::update(bool poll) {
+    buttons = 0;
+    if (player != NULL) {
+        buttons = player->read();
+        // at the end of the replay, the player regains control
+        if (player->isOver()) player = NULL;
+    } else if (poll) {
+        for (uint8_t i = 0; i < sizeof(used) / sizeof(Button); i++) {
+            if (gb.buttons.pressed(used[i])) buttons |= 1 << (uint8_t)used[i];
+        }
+    }
+
+    if (recorder != NULL && !recorder->write(buttons)) {
+        // the recording stops when the replay is full
+        recorder = NULL;
+    }
+}
+
+// determines if a button has just been pressed
+bool Input::pressed(Button button) {
+    return buttons & (1 << (uint8_t)button);
+}
+
+// determines if any button has just been pressed
+bool Input::pressedAny() {
+    return buttons != 0;
+}
+
+// forgets the buttons pressed on the current frame
+void Input::clear() {
+    buttons = 0;
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                                Player Input
+// -------------------------------------------------------------------------
+// The game engine does not query the buttons of the META directly: they are
+// read once per frame by this module, which can also record them in a
+// replay, or take them from a replay instead of the buttons.
+// -------------------------------------------------------------------------
+
+#ifndef DONKEY_KONG_JR_INPUT
+#define DONKEY_KONG_JR_INPUT
+
+// loads external modules
+#include "Replay.h" // handles the recording of the buttons
+
+// loads the official library
+#include <Gamebuino-Meta.h>
+
+// the class definition
+class Input
+{
+    private:
+
+        uint8_t  buttons;  // buttons pressed on the current frame (one bit per button)
+        Replay * recorder; // replay in which the buttons are recorded (if any)
+        Replay * player;   // replay from which the buttons are read (if any)
+
+    public:
+
+        Input(); // constructor
+
+        void record(Replay * replay);  // starts recording the buttons (or stops it with NULL)
+        void play(Replay * replay);    // starts reading the buttons from a replay (or stops it with NULL)
+        bool isPlaying();              // indicates that the buttons are read from a replay
+
+        void update(bool poll = true); // reads the buttons pressed on the current frame (unless they are not polled)
+        bool pressed(Button button);   // determines if a button has just been pressed
+        bool pressedAny();             // determines if any button has just been pressed
+        void clear();                  // forgets the buttons pressed on the current frame
+};
+
+#endif
\ No newline at end of file
@@ -11,12 +11,9 @@
 // loads the header file of the class
 #include "Player.h"
 
-// loads external modules
-#include "../graphics/sprites.h" // loads the description of all sprites
-#include "../sounds/Buzzer.h"    // loads the definition of the sound effects controller
-
 // constructor
-Player::Player() {
+Player::Player(Buzzer * buzzer) {
+    this->buzzer = buzzer;
     reset();
 }
 
@@ -31,9 +28,9 @@ void Player::reset() {
 }
 
 // moves the avatar in one direction, possibly emitting a sound
-void Player::move(const int8_t * direction, bool withSound) {
+void Player::move(Direction direction, bool withSound) {
     // determines the next posture of the avatar
-    int8_t next = direction[spriteIndex];
+    int8_t next = nextPosture(spriteIndex, direction);
     // and if this posture is allowed...
     if (next != Forbidden) {
         // stores the current posture
@@ -44,7 +41,7 @@ void Player::move(const int8_t * direction, bool withSound) {
         // the time at which it occurs is saved
         if (isJumping()) timer = gb.frameCount;
         // if a sound is to be played, now is the time to do so
-        if (withSound) Buzzer::play(Sound::Move);
+        if (withSound) buzzer->play(Sound::Move);
     }
 }
 
@@ -52,7 +49,7 @@ void Player::move(const int8_t * direction, bool withSound) {
 void Player::grab() {
     spriteIndex = GrabKey;     // the correct posture is set
     timer = gb.frameCount;     // the time at which it occurs is saved
-    Buzzer::play(Sound::Move); // and the corresponding sound effect is played
+    buzzer->play(Sound::Move); // and the corresponding sound effect is played
 }
 
 // engages the cage unlocking
@@ -82,7 +79,7 @@ void Player::fall(FallState state) {
         case FallState::Down:
             spriteIndex = Fall2; // the correct posture is set
             // and a sound effect is played on the ending step
-            Buzzer::repeat(Sound::Lost, 5, 8);
+            buzzer->repeat(Sound::Lost, 5, 8);
             break;
     }
 }
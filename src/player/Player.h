@@ -14,6 +14,9 @@
 // loads the official library
 #include <Gamebuino-Meta.h>
 
+#include "../graphics/sprites.h" // loads the description of all sprites
+#include "../sounds/Buzzer.h"     // loads the definition of the sound effects controller
+
 // defines the steps for unlocking the cage
 enum class ArmState : uint8_t {
     None,
@@ -32,6 +35,10 @@ enum class FallState : uint8_t {
 // the avatar definition
 class Player
 {
+    private:
+
+        Buzzer * buzzer; // reference to the sound effects controller
+
     public:
 
         ArmState  armState;        // cage unlocking step
@@ -41,12 +48,12 @@ class Player
         uint32_t  startupTime;     // start timecode at the bottom of the screen
         uint32_t  timer;           // internal clock for event synchronization
 
-        Player(); // constructor
+        Player(Buzzer * buzzer); // constructor
 
         void reset(); // resets the avatar
 
         // moves the avatar in one direction, possibly emitting a sound
-        void move(const int8_t * direction, bool withSound = true);
+        void move(Direction direction, bool withSound = true);
 
         void grab();                 // attempt to grab the key
         void unlock(ArmState state); // engages the cage unlocking
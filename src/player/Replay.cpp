@@ -0,0 +1,133 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                               Input Replays
+// -------------------------------------------------------------------------
+
+// loads the header file of the class
+#include "Replay.h"
+
+// constructor
+Replay::Replay(uint8_t * data, uint32_t capacity) {
+    this->data     = data;
+    this->capacity = capacity;
+    seed  = 0;
+    start = 0;
+    clear();
+}
+
+// erases the recording
+void Replay::clear() {
+    size    = 0;
+    frames  = 0;
+    pending = 0;
+    rewind();
+}
+
+// takes into account a recording that has been copied into the memory area
+void Replay::load(uint32_t size, uint32_t frames) {
+    this->size   = size > capacity ? capacity : size;
+    this->frames = frames;
+    rewind();
+}
+
+// restarts the reading from the beginning
+void Replay::rewind() {
+    position = 0;
+    frame    = 0;
+    gapRead  = false;
+}
+
+// -------------------------------------------------------------------------
+// Recording
+// -------------------------------------------------------------------------
+
+// records the buttons pressed on the next frame
+bool Replay::write(uint8_t buttons) {
+    // an empty frame is simply counted
+    if (buttons == 0) {
+        pending++;
+        frames++;
+        return true;
+    }
+
+    // otherwise, the number of empty frames that precede it must be
+    // written first, 7 bits per byte (the high bit announces a next byte)
+    uint8_t length = 1;
+    for (uint32_t n = pending >> 7; n; n >>= 7) length++;
+    if (size + length + 1 > capacity) return false;
+
+    while (pending >= 0x80) {
+        data[size++] = (pending & 0x7f) | 0x80;
+        pending >>= 7;
+    }
+    data[size++] = pending;
+    data[size++] = buttons;
+
+    pending = 0;
+    frames++;
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// Playback
+// -------------------------------------------------------------------------
+
+// reads a variable-length number
+uint32_t Replay::readNumber() {
+    uint32_t number = 0;
+    uint8_t  shift  = 0;
+    while (position < size) {
+        uint8_t byte = data[position++];
+        number |= (uint32_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) break;
+        shift += 7;
+    }
+    return number;
+}
+
+// reads the buttons pressed on the next frame
+uint8_t Replay::read() {
+    if (frame >= frames) return 0;
+    frame++;
+
+    if (!gapRead) {
+        if (position >= size) return 0;
+        gap     = readNumber();
+        gapRead = true;
+    }
+
+    if (gap) {
+        gap--;
+        return 0;
+    }
+
+    gapRead = false;
+    return position < size ? data[position++] : 0;
+}
+
+// indicates that all the recorded frames have been read
+bool Replay::isOver() {
+    return frame >= frames;
+}
+
+// -------------------------------------------------------------------------
+// Accessors
+// -------------------------------------------------------------------------
+
+const uint8_t * Replay::getData() {
+    return data;
+}
+
+uint32_t Replay::getSize() {
+    return size;
+}
+
+uint32_t Replay::getFrames() {
+    return frames;
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                               Input Replays
+// -------------------------------------------------------------------------
+// A replay is the recording of the buttons pressed by the player on each
+// frame of a session. Since the game engine draws its random numbers from
+// its own seeded generator, feeding the recording back to a new game engine
+// started with the same seed reproduces the session exactly.
+//
+// On most frames, no button is pressed at all. The recording is therefore
+// delta-compressed: only the frames on which a button is pressed are
+// stored, each one as the number of empty frames that precede it (a
+// variable-length number, 7 bits per byte) followed by the buttons pressed
+// (one bit per button). A frame costs nothing when no button is pressed,
+// and two or three bytes otherwise.
+//
+// The bytes are written to a memory area provided by the owner of the
+// replay, which is also in charge of saving or loading them.
+// -------------------------------------------------------------------------
+
+#ifndef DONKEY_KONG_JR_REPLAY
+#define DONKEY_KONG_JR_REPLAY
+
+// loads the official library
+#include <Gamebuino-Meta.h>
+
+// the class definition
+class Replay
+{
+    private:
+
+        uint8_t * data;     // the recorded bytes
+        uint32_t  capacity; // size of the memory area allocated to the bytes
+        uint32_t  size;     // number of recorded bytes
+        uint32_t  frames;   // number of recorded frames
+        uint32_t  pending;  // number of empty frames recorded since the last pressure
+        uint32_t  position; // reading position in the recorded bytes
+        uint32_t  frame;    // number of frames already read
+        uint32_t  gap;      // number of empty frames before the next pressure
+        bool      gapRead;  // indicates that the number of empty frames has been read
+
+        uint32_t readNumber(); // reads a variable-length number
+
+    public:
+
+        uint32_t seed;  // seed of the game engine at the beginning of the session
+        uint32_t start; // frame count of the META at the beginning of the session
+
+        Replay(uint8_t * data, uint32_t capacity); // constructor
+
+        void clear();                                // erases the recording
+        void load(uint32_t size, uint32_t frames);   // takes into account bytes copied into the memory area
+        void rewind();                               // restarts the reading from the beginning
+
+        bool    write(uint8_t buttons); // records the buttons pressed on the next frame (false when full)
+        uint8_t read();                 // reads the buttons pressed on the next frame
+        bool    isOver();               // indicates that all the recorded frames have been read
+
+        const uint8_t * getData();   // returns the recorded bytes
+        uint32_t        getSize();   // returns the number of recorded bytes
+        uint32_t        getFrames(); // returns the number of recorded frames
+};
+
+#endif
\ No newline at end of file
@@ -11,14 +11,6 @@
 // loads the header file of the class
 #include "Buzzer.h"
 
-// initializes the properties of the controller
-Sound    Buzzer::toRepeat    = Sound::None;
-uint8_t  Buzzer::counter     = 0;
-uint32_t Buzzer::timer       = 0;
-uint8_t  Buzzer::delay       = 0;
-bool     Buzzer::mute        = false;
-bool     Buzzer::hasRepeated = false;
-
 // control loop
 void Buzzer::update() {
     // if there are any sounds left to play...
@@ -37,8 +29,8 @@ void Buzzer::update() {
 
 // plays a specific sound without delay
 void Buzzer::play(Sound sound) {
-    // only if the sound has not been muted
-    if (mute) return;
+    // only if the sound has not been muted or discarded
+    if (mute || silent) return;
 
     switch (sound) {
         case Sound::Tick:
@@ -62,7 +54,7 @@ void Buzzer::repeat(Sound sound, uint8_t count, uint8_t delay) {
     toRepeat      = sound;
     counter       = count - 1;
     timer         = gb.frameCount;
-    Buzzer::delay = delay;
+    this->delay   = delay;
     hasRepeated   = false;
 }
 
@@ -71,6 +63,11 @@ void Buzzer::toggleMute() {
     mute = !mute;
 }
 
+// discards the sound effects (or plays them again)
+void Buzzer::setSilent(bool silent) {
+    this->silent = silent;
+}
+
 // -------------------------------------------------------------------------
 // WAV sounds consume toooooo much CPU...  🙁  set up FX are much better!
 // -------------------------------------------------------------------------
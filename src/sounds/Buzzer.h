@@ -46,24 +46,39 @@ class Buzzer
 {
     private:
     
-        static Sound    toRepeat; // the sound effect to be repeated at regular intervals
-        static uint8_t  counter;  // counts the number of repetitions already performed
-        static uint32_t timer;    // internal clock
-        static uint8_t  delay;    // delay that punctuates the start of playback for each repetition
-        static bool     mute;     // indicates whether or not the sound is muted
+        Sound    toRepeat; // the sound effect to be repeated at regular intervals
+        uint8_t  counter;  // counts the number of repetitions already performed
+        uint32_t timer;    // internal clock
+        uint8_t  delay;    // delay that punctuates the start of playback for each repetition
+        bool     mute;     // indicates whether or not the sound is muted
+        bool     silent;   // indicates that the sound effects are discarded
 
     public:
 
-        static bool hasRepeated; // indicates that the repetition of a sound effect is over
+        bool hasRepeated; // indicates that the repetition of a sound effect is over
+
+        // constructor
+        Buzzer() :
+            toRepeat(Sound::None),
+            counter(0),
+            timer(0),
+            delay(0),
+            mute(false),
+            silent(false),
+            hasRepeated(false)
+            {}
 
         // control loop
-        static void update();
+        void update();
         // plays a sound without delay
-        static void play(Sound sound);
+        void play(Sound sound);
         // triggers the repetition of a sound at regular intervals
-        static void repeat(Sound sound, uint8_t count, uint8_t delay);
+        void repeat(Sound sound, uint8_t count, uint8_t delay);
         // switch the mute indicator
-        static void toggleMute();
+        void toggleMute();
+        // discards the sound effects (or plays them again),
+        // without affecting the timing of their repetitions
+        void setSilent(bool silent);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,465 @@
+// -------------------------------------------------------------------------
+//                               Donkey Kong Jr
+//           a Nintendo's Game & Watch adaptation on Gamebuino META
+// -------------------------------------------------------------------------
+//                                © 2019 Steph
+//                        https://gamebuino.com/@steph
+// -------------------------------------------------------------------------
+//                               Asset Compiler
+// -------------------------------------------------------------------------
+// This host tool reads the original images of the `assets` folder and
+// writes the C++ headers describing the graphic resources of the game:
+//
+//     assets path/to/assets path/to/src/graphics
+//
+// - `assets.h`      : the backgrounds, palettized, and the digits of the
+//                     counter
+// - `spritesheet.h` : the sprites declared in `assets/sprites.def`, with
+//                     their packed masks and their bounding boxes, derived
+//                     from the pixels of their key color on the spritesheet
+//
+// It is run by the `assets` CMake target, so that the format of the
+// resources can be changed without editing the generated headers by hand.
+// -------------------------------------------------------------------------
+
+#include <png.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// -------------------------------------------------------------------------
+// Images
+// -------------------------------------------------------------------------
+
+struct Image {
+    uint32_t             width;
+    uint32_t             height;
+    std::vector<uint8_t> rgb;
+
+    // returns the color of a pixel as a 0xRRGGBB code
+    uint32_t pixel(uint32_t x, uint32_t y) const {
+        const uint8_t * p = &rgb[3 * (x + y * width)];
+        return p[0] << 16 | p[1] << 8 | p[2];
+    }
+};
+
+// loads a PNG image, whatever its color type, as 24-bit RGB
+static bool load(Image & image, const std::string & path) {
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+
+    if (!png_image_begin_read_from_file(&png, path.c_str())) {
+        fprintf(stderr, "%s: %s\n", path.c_str(), png.message);
+        return false;
+    }
+
+    png.format   = PNG_FORMAT_RGB;
+    image.width  = png.width;
+    image.height = png.height;
+    image.rgb.resize(PNG_IMAGE_SIZE(png));
+
+    if (!png_image_finish_read(&png, NULL, image.rgb.data(), 0, NULL)) {
+        fprintf(stderr, "%s: %s\n", path.c_str(), png.message);
+        return false;
+    }
+
+    return true;
+}
+
+// converts a 0xRRGGBB color into the RGB565 code expected by the display.
+// the two bytes are swapped, since the buffers are sent as is to the
+// display device, which reads the most significant byte first
+static uint16_t rgb565(uint32_t rgb) {
+    uint16_t c = ((rgb >> 8) & 0xf800) | ((rgb >> 5) & 0x07e0) | ((rgb >> 3) & 0x001f);
+    return (c << 8) | (c >> 8);
+}
+
+// -------------------------------------------------------------------------
+// Output
+// -------------------------------------------------------------------------
+
+static constexpr uint8_t ScreenWidth  = 160;
+static constexpr uint8_t ScreenHeight = 128;
+
+// writes the header of a generated file, with an optional note
+static void writeBanner(FILE * file, const char * title, const char * guard, const char * note = "") {
+    fprintf(file,
+        "// -------------------------------------------------------------------------\n"
+        "//                               Donkey Kong Jr\n"
+        "//           a Nintendo's Game & Watch adaptation on Gamebuino META\n"
+        "// -------------------------------------------------------------------------\n"
+        "//                                © 2019 Steph\n"
+        "//                        https://gamebuino.com/@steph\n"
+        "// -------------------------------------------------------------------------\n"
+        "%s\n"
+        "// -------------------------------------------------------------------------\n"
+        "// This file is generated by the asset compiler (`tools/assets.cpp`) from\n"
+        "// the images of the `assets` folder: do not edit it by hand.\n"
+        "%s"
+        "// -------------------------------------------------------------------------\n"
+        "\n"
+        "#ifndef %s\n"
+        "#define %s\n"
+        "\n",
+        title, note, guard, guard
+    );
+}
+
+// writes the pixels of an image as RGB565 codes, one image row per line
+static size_t writeColormap(FILE * file, const Image & image) {
+    for (uint32_t y = 0; y < image.height; y++) {
+        fprintf(file, "\t");
+        for (uint32_t x = 0; x < image.width; x++) fprintf(file, "0x%04x, ", rgb565(image.pixel(x, y)));
+        fprintf(file, "\n");
+    }
+    return image.width * image.height * sizeof(uint16_t);
+}
+
+// -------------------------------------------------------------------------
+// Palettes
+// -------------------------------------------------------------------------
+
+// adds the colors of an image to a palette (in the order they appear)
+static bool addColors(std::vector<uint16_t> & palette, const Image & image) {
+    for (uint32_t y = 0; y < image.height; y++) {
+        for (uint32_t x = 0; x < image.width; x++) {
+            uint16_t color = rgb565(image.pixel(x, y));
+            if (std::find(palette.begin(), palette.end(), color) == palette.end()) palette.push_back(color);
+        }
+    }
+    if (palette.size() > 256) {
+        fprintf(stderr, "the backgrounds use more than 256 colors\n");
+        return false;
+    }
+    return true;
+}
+
+static size_t writePalette(FILE * file, const std::vector<uint16_t> & palette) {
+    for (size_t i = 0; i < palette.size(); i++) {
+        fprintf(file, "%s0x%04x,%s", i % 8 ? " " : "\t", palette[i], i % 8 == 7 || i + 1 == palette.size() ? "\n" : "");
+    }
+    return palette.size() * sizeof(uint16_t);
+}
+
+// writes the pixels of an image as indices in a palette, one image row per line
+static size_t writeIndices(FILE * file, const Image & image, const std::vector<uint16_t> & palette) {
+    for (uint32_t y = 0; y < image.height; y++) {
+        fprintf(file, "\t");
+        for (uint32_t x = 0; x < image.width; x++) {
+            size_t index = std::find(palette.begin(), palette.end(), rgb565(image.pixel(x, y))) - palette.begin();
+            fprintf(file, "0x%02x, ", (unsigned)index);
+        }
+        fprintf(file, "\n");
+    }
+    return image.width * image.height;
+}
+
+// -------------------------------------------------------------------------
+// Boot scene
+// -------------------------------------------------------------------------
+// The boot scene only differs from the stage in a few places: it is stored
+// as the runs of pixels that must be painted over the stage, row by row.
+// Each run is encoded as a sequence of bytes:
+//
+//     skip, length, index 1, index 2, ... index n (n = length)
+//
+// where `skip` is the number of pixels to leave untouched before the run.
+// Two runs separated by only a couple of unchanged pixels are merged, which
+// costs less than the header of a new run.
+
+static constexpr uint8_t MaxGap = 2;
+
+// writes the runs of pixels that differ from the stage on each row
+static size_t writeDelta(FILE * file, const Image & stage, const Image & boot, const std::vector<uint16_t> & palette) {
+    std::vector<uint8_t>  delta;
+    std::vector<uint16_t> rows;
+
+    for (uint32_t y = 0; y < boot.height; y++) {
+        rows.push_back(delta.size());
+        uint32_t x    = 0;
+        uint32_t last = 0; // end of the previous run
+        while (x < boot.width) {
+            if (boot.pixel(x, y) == stage.pixel(x, y)) { x++; continue; }
+            // the run goes on as long as the next difference is close enough
+            uint32_t start = x;
+            uint32_t end   = x + 1;
+            for (uint32_t i = end; i < boot.width && i - end <= MaxGap && i - start < 255; i++) {
+                if (boot.pixel(i, y) != stage.pixel(i, y)) end = i + 1;
+            }
+            delta.push_back(start - last);
+            delta.push_back(end - start);
+            for (uint32_t i = start; i < end; i++) {
+                delta.push_back(std::find(palette.begin(), palette.end(), rgb565(boot.pixel(i, y))) - palette.begin());
+            }
+            x = last = end;
+        }
+    }
+    rows.push_back(delta.size());
+
+    fprintf(file, "constexpr uint16_t BOOT_ROWS[] = {\n");
+    for (size_t i = 0; i < rows.size(); i++) {
+        fprintf(file, "%s%5u,%s", i % 8 ? " " : "\t", rows[i], i % 8 == 7 || i + 1 == rows.size() ? "\n" : "");
+    }
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "constexpr uint8_t BOOT_DELTA[] = {\n");
+    for (size_t i = 0; i < delta.size(); i++) {
+        fprintf(file, "%s0x%02x,%s", i % 16 ? " " : "\t", delta[i], i % 16 == 15 || i + 1 == delta.size() ? "\n" : "");
+    }
+    fprintf(file, "};\n\n");
+
+    return rows.size() * sizeof(uint16_t) + delta.size();
+}
+
+// -------------------------------------------------------------------------
+// Backgrounds and digits
+// -------------------------------------------------------------------------
+
+static bool writeAssets(const std::string & path, const Image & stage, const Image & boot, const Image & digits) {
+    FILE * file = fopen(path.c_str(), "w");
+    if (file == NULL) {
+        fprintf(stderr, "unable to write %s\n", path.c_str());
+        return false;
+    }
+
+    // both backgrounds share the same palette
+    std::vector<uint16_t> palette;
+    if (!addColors(palette, stage) || !addColors(palette, boot)) {
+        fclose(file);
+        return false;
+    }
+
+    size_t size = 0;
+
+    writeBanner(file, "//                               Graphic Assets", "DONKEY_KONG_JR_ASSETS",
+        "//\n"
+        "// The backgrounds are stored as 8-bit indices in a common color lookup\n"
+        "// table, which is expanded in RGB565 at rendering time. The boot scene\n"
+        "// is stored as the runs of pixels that differ from the stage.\n"
+    );
+
+    fprintf(file, "// loads the official library\n#include <Gamebuino-Meta.h>\n\n");
+
+    fprintf(file, "constexpr uint16_t STAGE_PALETTE[] = {\n");
+    size += writePalette(file, palette);
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "constexpr uint8_t STAGE_BITMAP[] = {\n");
+    size += writeIndices(file, stage, palette);
+    fprintf(file, "};\n\n");
+
+    size += writeDelta(file, stage, boot, palette);
+
+    fprintf(file, "constexpr uint16_t DIGIT_COLORMAP[] = {\n");
+    size += writeColormap(file, digits);
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "#endif");
+    fclose(file);
+
+    printf("%s: %u bytes (%u background colors)\n", path.c_str(), (unsigned)size, (unsigned)palette.size());
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// Sprites
+// -------------------------------------------------------------------------
+
+enum Kind {
+    Begin,  // beginning of a sprite array
+    Entry,  // element of a sprite array
+    End,    // end of a sprite array
+    Single  // isolated sprite
+};
+
+struct Declaration {
+    Kind         kind;
+    const char * name;
+    uint8_t      x;
+    uint8_t      y;
+    uint8_t      width;
+    uint8_t      height;
+    uint32_t     color;
+    const char * label;
+};
+
+#define BEGIN_SPRITES(name)                              { Begin,  #name, 0, 0, 0, 0, 0, "" },
+#define SPRITE(x, y, width, height, color, label)       { Entry,  "", x, y, width, height, color, #label },
+#define END_SPRITES                                      { End,    "", 0, 0, 0, 0, 0, "" },
+#define SINGLE_SPRITE(name, x, y, width, height, color) { Single, #name, x, y, width, height, color, "" },
+
+static const Declaration declarations[] = {
+    #include "../assets/sprites.def"
+};
+
+// the actual envelope of a sprite, and its mask
+struct Sprite {
+    std::string           name;
+    std::string           label;
+    uint8_t               x;
+    uint8_t               y;
+    uint8_t               width;
+    uint8_t               height;
+    std::vector<uint32_t> mask;
+};
+
+// looks for the pixels of the key color of a sprite in the region where it
+// is declared, in order to determine its exact envelope and its mask
+static bool extract(Sprite & sprite, const Declaration & d, const Image & sheet) {
+    uint8_t xmin = 255, ymin = 255, xmax = 0, ymax = 0;
+
+    for (uint8_t y = d.y; y < d.y + d.height && y < sheet.height; y++) {
+        for (uint8_t x = d.x; x < d.x + d.width && x < sheet.width; x++) {
+            if (sheet.pixel(x, y) != d.color) continue;
+            if (x < xmin) xmin = x;
+            if (x > xmax) xmax = x;
+            if (y < ymin) ymin = y;
+            if (y > ymax) ymax = y;
+        }
+    }
+
+    if (xmin > xmax) {
+        fprintf(stderr, "sprite %s: no pixel of color 0x%06x found\n", sprite.name.c_str(), d.color);
+        return false;
+    }
+
+    if (xmax - xmin >= 32) {
+        fprintf(stderr, "sprite %s is wider than 32 pixels\n", sprite.name.c_str());
+        return false;
+    }
+
+    sprite.x      = xmin;
+    sprite.y      = ymin;
+    sprite.width  = xmax - xmin + 1;
+    sprite.height = ymax - ymin + 1;
+
+    // each row is packed into a 32-bit word,
+    // whose least significant bit corresponds to the leftmost pixel
+    sprite.mask.clear();
+    for (uint8_t y = ymin; y <= ymax; y++) {
+        uint32_t bits = 0;
+        for (uint8_t x = xmin; x <= xmax; x++) {
+            if (sheet.pixel(x, y) == d.color) bits |= 1UL << (x - xmin);
+        }
+        sprite.mask.push_back(bits);
+    }
+
+    return true;
+}
+
+static size_t writeMask(FILE * file, const std::string & name, const Sprite & sprite) {
+    fprintf(file, "constexpr uint32_t %s[] = {\n   ", name.c_str());
+    for (size_t row = 0; row < sprite.mask.size(); row++) {
+        fprintf(file, " 0x%08x%s", sprite.mask[row], row + 1 < sprite.mask.size() ? "," : "");
+        if (row % 6 == 5 && row + 1 < sprite.mask.size()) fprintf(file, "\n   ");
+    }
+    fprintf(file, "\n};\n\n");
+    return sprite.mask.size() * sizeof(uint32_t);
+}
+
+// writes the description of a sprite, followed by the given separator
+static void writeSprite(FILE * file, const std::string & mask, const Sprite & sprite, const char * separator) {
+    fprintf(file, "{ %3u, %3u, %2u, %2u, %s }%s", sprite.x, sprite.y, sprite.width, sprite.height, mask.c_str(), separator);
+    if (!sprite.label.empty()) fprintf(file, " // %s", sprite.label.c_str());
+    fprintf(file, "\n");
+}
+
+static bool writeSpritesheet(const std::string & path, const Image & sheet) {
+    FILE * file = fopen(path.c_str(), "w");
+    if (file == NULL) {
+        fprintf(stderr, "unable to write %s\n", path.c_str());
+        return false;
+    }
+
+    writeBanner(file, "//                               Sprite Masks", "DONKEY_KONG_JR_SPRITESHEET",
+        "//\n"
+        "// Each row of a sprite is packed into a 32-bit word, one bit per pixel: the\n"
+        "// least significant bit corresponds to the leftmost pixel of the sprite.\n"
+    );
+
+    const size_t count = sizeof(declarations) / sizeof(Declaration);
+    size_t       size  = 0;
+    bool         ok    = true;
+    std::string  table;
+    std::vector<Sprite> sprites;
+
+    for (size_t i = 0; i < count && ok; i++) {
+        const Declaration & d = declarations[i];
+        Sprite sprite;
+        switch (d.kind) {
+            case Begin:
+                table = d.name;
+                sprites.clear();
+                break;
+            case Entry:
+                sprite.name  = table + "[" + std::to_string(sprites.size()) + "]";
+                sprite.label = d.label;
+                if (!(ok = extract(sprite, d, sheet))) break;
+                size += writeMask(file, table + "Mask" + std::to_string(sprites.size()), sprite);
+                sprites.push_back(sprite);
+                break;
+            case End:
+                fprintf(file, "constexpr Sprite %s[] = {\n", table.c_str());
+                for (size_t j = 0; j < sprites.size(); j++) {
+                    fprintf(file, "    ");
+                    writeSprite(file, table + "Mask" + std::to_string(j), sprites[j], j + 1 == sprites.size() ? "" : ",");
+                }
+                fprintf(file, "};\n\n");
+                break;
+            case Single:
+                sprite.name = d.name;
+                if (!(ok = extract(sprite, d, sheet))) break;
+                size += writeMask(file, sprite.name + "Mask", sprite);
+                fprintf(file, "constexpr Sprite %s = ", d.name);
+                writeSprite(file, sprite.name + "Mask", sprite, ";");
+                fprintf(file, "\n");
+                break;
+        }
+    }
+
+    fprintf(file, "#endif");
+    fclose(file);
+
+    if (ok) printf("%s: %u bytes of sprite masks\n", path.c_str(), (unsigned)size);
+
+    return ok;
+}
+
+// -------------------------------------------------------------------------
+// Entry point
+// -------------------------------------------------------------------------
+
+static bool check(const Image & image, const char * name, uint32_t width, uint32_t height) {
+    if (image.width == width && image.height == height) return true;
+    fprintf(stderr, "%s must be %ux%u pixels\n", name, width, height);
+    return false;
+}
+
+int main(int argc, char * argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s assets-folder output-folder\n", argv[0]);
+        return 1;
+    }
+
+    std::string input  = std::string(argv[1]) + "/";
+    std::string output = std::string(argv[2]) + "/";
+
+    Image stage, boot, digits, sheet;
+
+    if (!load(stage,  input + "background.png")  || !check(stage,  "background.png",  ScreenWidth, ScreenHeight) ||
+        !load(boot,   input + "bootscene.png")   || !check(boot,   "bootscene.png",   ScreenWidth, ScreenHeight) ||
+        !load(digits, input + "digits.png")      || !check(digits, "digits.png",      50, 9) ||
+        !load(sheet,  input + "spritesheet.png") || !check(sheet,  "spritesheet.png", ScreenWidth, ScreenHeight)) {
+        return 1;
+    }
+
+    if (!writeAssets(output + "assets.h", stage, boot, digits)) return 1;
+    if (!writeSpritesheet(output + "spritesheet.h", sheet))     return 1;
+
+    return 0;
+}